@@ -206,6 +206,56 @@ enum nrf_wifi_status nrf_wifi_fmac_otp_mac_addr_get(struct nrf_wifi_fmac_dev_ctx
 						    unsigned char *mac_addr);
 
 
+/**
+ * @brief Fetch the OTP parameters.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param otp_info Pointer to the address where the OTP information needs to be copied.
+ * @param ft_prog_ver Pointer to the FT program version, can be NULL if not needed.
+ * @param package_info Pointer to the package information, can be NULL if not needed.
+ *
+ * This function is used to fetch the OTP parameters from the RPU. With
+ * NRF_WIFI_OTP_CACHE only the first call reads the OTP, later calls
+ * (e.g. after a recovery) are served from the cache.
+ *
+ * @return Command execution status
+ */
+enum nrf_wifi_status nrf_wifi_fmac_otp_params_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						  struct nrf_wifi_fmac_otp_info *otp_info,
+						  unsigned int *ft_prog_ver,
+						  unsigned int *package_info);
+
+#ifdef NRF_WIFI_OTP_CACHE
+/**
+ * @brief Export the cached OTP parameters.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param otp_cache Pointer to the address where the cache needs to be copied.
+ *
+ * This function is used to save the OTP parameters read at init, e.g.
+ * before a mode switch or to persistent storage, so that they can be
+ * restored with nrf_wifi_fmac_otp_cache_import().
+ *
+ * @return Command execution status
+ */
+enum nrf_wifi_status nrf_wifi_fmac_otp_cache_export(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						    struct nrf_wifi_fmac_otp_cache *otp_cache);
+
+
+/**
+ * @brief Import previously exported OTP parameters.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param otp_cache Pointer to the cache returned by nrf_wifi_fmac_otp_cache_export().
+ *
+ * This function is used to seed the OTP cache before the device is
+ * initialized. The cache is checked against the UUID of the chip on
+ * first use and discarded if it belongs to another chip.
+ *
+ * @return Command execution status
+ */
+enum nrf_wifi_status nrf_wifi_fmac_otp_cache_import(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						    const struct nrf_wifi_fmac_otp_cache *otp_cache);
+#endif /* NRF_WIFI_OTP_CACHE */
+
+
 /**
  * @brief Set regulatory domain in RPU.
  * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
@@ -18,6 +18,7 @@
 
 #include "osal_api.h"
 #include "host_rpu_umac_if.h"
+#include "common/hal_structs_common.h"
 
 #define NRF_WIFI_FW_CHUNK_ID_STR_LEN 16
 
@@ -48,10 +49,20 @@ struct rpu_host_stats {
 	unsigned long long total_tx_done_pkts;
 	/** Total number of TX frames dropped. */
 	unsigned long long total_tx_drop_pkts;
+	/** Total number of queued TCP ACKs superseded by a newer ACK. */
+	unsigned long long total_tx_ack_suppressed_pkts;
 	/** Total number of RX frames received. */
 	unsigned long long total_rx_pkts;
 	/** Total number of RX frames dropped. */
 	unsigned long long total_rx_drop_pkts;
+	/** Total number of RX tasklet runs. */
+	unsigned long long total_rx_tasklet_runs;
+	/** Total number of RX events processed by the RX tasklet. */
+	unsigned long long total_rx_tasklet_events;
+	/** Total number of TX done tasklet runs. */
+	unsigned long long total_tx_done_tasklet_runs;
+	/** Total number of TX done events processed by the TX done tasklet. */
+	unsigned long long total_tx_done_tasklet_events;
 };
 
 
@@ -80,6 +91,33 @@ struct nrf_wifi_fmac_fw_info {
 	struct nrf_wifi_fw_info umac_patch_pri;
 	/** Secondary UMAC FW patch information. */
 	struct nrf_wifi_fw_info umac_patch_sec;
+#if defined(NRF_WIFI_PATCH_HASH_CHECK) || defined(__DOXYGEN__)
+	/** Expected SHA-256 hash of the FW images, NULL if not to be checked. */
+	const unsigned char *hash;
+	/** Start of the FW image data covered by the hash. */
+	const void *hash_data;
+	/** Length of the FW image data covered by the hash. */
+	unsigned int hash_data_len;
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
+};
+
+/**
+ * @brief Structure to hold the time spent in each phase of the FW load.
+ *
+ */
+struct nrf_wifi_fmac_fw_load_stats {
+	/** Time taken to reset the RPU processors (in us). */
+	unsigned int reset_us;
+	/** Time taken to load the UMAC patches (in us). */
+	unsigned int umac_load_us;
+	/** Time taken to load the LMAC patches (in us). */
+	unsigned int lmac_load_us;
+	/** Time taken to boot and check the boot signature of the RPU processors (in us). */
+	unsigned int boot_us;
+#if defined(NRF_WIFI_PATCH_HASH_CHECK) || defined(__DOXYGEN__)
+	/** Time spent in computing the FW image hash (in us). */
+	unsigned int hash_us;
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
 };
 
 /**
@@ -108,6 +146,43 @@ struct nrf_wifi_fmac_otp_info {
 	unsigned int flags;
 };
 
+#ifdef NRF_WIFI_OTP_CACHE
+/** Signature of a @ref nrf_wifi_fmac_otp_cache blob ("OTPC"). */
+#define NRF_WIFI_OTP_CACHE_MAGIC 0x4F545043
+/** Layout version of a @ref nrf_wifi_fmac_otp_cache blob. */
+#define NRF_WIFI_OTP_CACHE_VERSION 1
+
+/**
+ * @brief OTP parameters cached after the first read from the RPU.
+ *
+ * The cache is kept in the device context so that recovery and re-init
+ * do not read the OTP again. It can also be exported and imported to
+ * survive a mode switch or a host reboot, see nrf_wifi_fmac_otp_cache_export().
+ */
+struct nrf_wifi_fmac_otp_cache {
+	/** @ref NRF_WIFI_OTP_CACHE_MAGIC. */
+	unsigned int magic;
+	/** @ref NRF_WIFI_OTP_CACHE_VERSION. */
+	unsigned int version;
+	/** UUID of the chip the parameters were read from. */
+	unsigned int uuid[4];
+	/** Flags indicating which OTP regions are valid. */
+	unsigned int flags;
+	/** MAC address of VIF 0. */
+	unsigned int mac_address0[2];
+	/** MAC address of VIF 1. */
+	unsigned int mac_address1[2];
+	/** Calibration parameters. */
+	unsigned int calib[9];
+	/** FT program version. */
+	unsigned int ft_prog_ver;
+	/** Package information. */
+	unsigned int package_info;
+	/** Checksum over all the preceding fields. */
+	unsigned int csum;
+};
+#endif /* NRF_WIFI_OTP_CACHE */
+
 /* Maximum number of channels supported in a regulatory
  * currently set to 42 as hardware supports 2.4GHz and 5GHz.
  * In 2.4 GHz band maximum 14 channels and
@@ -185,6 +260,18 @@ struct nrf_wifi_fmac_dev_ctx {
 	struct nrf_wifi_event_regulatory_change *reg_change;
 	/** TX power ceiling parameters */
 	struct nrf_wifi_tx_pwr_ceil_params *tx_pwr_ceil_params;
+	/** Time spent in each phase of the last FW load. */
+	struct nrf_wifi_fmac_fw_load_stats fw_load_stats;
+	/** RPU processors booted without a patch (from ROM only). */
+	bool is_patch_absent[RPU_PROC_TYPE_MAX];
+#ifdef NRF_WIFI_OTP_CACHE
+	/** OTP parameters cached from the first read. */
+	struct nrf_wifi_fmac_otp_cache otp_cache;
+	/** The OTP cache holds valid parameters. */
+	bool otp_cache_valid;
+	/** The OTP cache has been checked against the UUID of this chip. */
+	bool otp_cache_verified;
+#endif /* NRF_WIFI_OTP_CACHE */
 	/** Data pointer to mode specific parameters */
 	char priv[];
 };
@@ -69,6 +69,19 @@
 #define NRF_WIFI_FMAC_IPV6_TOS_MASK 0x0FF0
 #define NRF_WIFI_FMAC_IPV6_TOS_SHIFT 0x04 /* 4bit */
 #define NRF_WIFI_FMAC_ETH_TYPE_MASK 0xFFFF
+#define NRF_WIFI_FMAC_IPV4_MIN_HDR_LEN 20
+#define NRF_WIFI_FMAC_IPV6_HDR_LEN 40
+#define NRF_WIFI_FMAC_IPV4_FRAG_MASK 0x3FFF /* MF flag + fragment offset */
+#define NRF_WIFI_FMAC_IP_PROTO_HOPOPTS 0
+#define NRF_WIFI_FMAC_IP_PROTO_IGMP 2
+#define NRF_WIFI_FMAC_IP_PROTO_TCP 6
+#define NRF_WIFI_FMAC_IP_PROTO_ICMPV6 58
+#define NRF_WIFI_FMAC_TCP_MIN_HDR_LEN 20
+#define NRF_WIFI_FMAC_TCP_FLAG_ACK 0x10
+#define NRF_WIFI_FMAC_TCP_OPT_EOL 0
+#define NRF_WIFI_FMAC_TCP_OPT_NOP 1
+#define NRF_WIFI_FMAC_TCP_OPT_TIMESTAMP 8
+#define NRF_WIFI_FMAC_TCP_OPT_TIMESTAMP_LEN 10
 
 struct nrf_wifi_fmac_ieee80211_hdr {
 	unsigned short fc;
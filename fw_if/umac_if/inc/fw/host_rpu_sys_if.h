@@ -171,6 +171,8 @@ enum nrf_wifi_sys_commands {
 	NRF_WIFI_CMD_OFFLOAD_RAW_TX_PARAMS,
 	/** Command to enable/disable raw tx offloading */
 	NRF_WIFI_CMD_OFFLOAD_RAW_TX_CTRL,
+	/** Command to set the raw tx offloading schedule table */
+	NRF_WIFI_CMD_OFFLOAD_RAW_TX_SCHED,
 };
 
 /**
@@ -1337,6 +1339,9 @@ enum nrf_wifi_offload_rawtx_ctrl_type {
 	NRF_WIFI_OFFLOAD_TX_CONFIG,
 };
 
+#define NRF_WIFI_OFFLOAD_TX_PWR_MIN 0
+#define NRF_WIFI_OFFLOAD_TX_PWR_MAX 20
+
 /**
  * @brief This structure defines the offloaded raw tx control information.
  *
@@ -1354,6 +1359,9 @@ struct nrf_wifi_offload_ctrl_params
 #define NRF_WIFI_ENABLE_HE_SU 0x40
 #define NRF_WIFI_ENABLE_HE_ER_SU 0x80
 
+#define NRF_WIFI_OFFLOAD_PKT_LEN_MIN 26
+#define NRF_WIFI_OFFLOAD_PKT_LEN_MAX 600
+
 /**
  * @brief This structure defines the offloading raw tx parameters
  *
@@ -1395,6 +1403,44 @@ struct nrf_wifi_cmd_offload_raw_tx_params {
 	struct nrf_wifi_offload_tx_ctrl tx_params;
 } __NRF_WIFI_PKD;
 
+#define NRF_WIFI_OFFLOAD_SCHED_MAX_ENTRIES 8
+
+/**
+ * @brief This structure defines an entry of the offloaded raw tx schedule table
+ *
+ */
+struct nrf_wifi_offload_sched_entry {
+	/** Transmission time relative to the start of the period in micro seconds */
+	unsigned int offset_in_us;
+	/** Transmit power in dBm ( 0 to 20) */
+	int tx_pwr;
+	/** Channel number */
+	unsigned int channel_no;
+	/** Offloaded raw tx params, @ref nrf_wifi_offload_tx_ctrl */
+	struct nrf_wifi_offload_tx_ctrl tx_params;
+} __NRF_WIFI_PKD;
+
+/**
+ * @brief This structure defines the command used to set the offloaded raw tx
+ * schedule table. The RPU transmits every entry once per period at its
+ * offset. A table received while transmitting replaces the current one at
+ * the next period boundary. The result is reported with
+ * NRF_WIFI_EVENT_OFFLOADED_RAWTX_STATUS.
+ *
+ */
+struct nrf_wifi_cmd_offload_raw_tx_sched {
+	/** UMAC header, @ref nrf_wifi_sys_head */
+	struct nrf_wifi_sys_head sys_head;
+	/** Id of the interface */
+	unsigned int wdev_id;
+	/** Schedule period in micro seconds */
+	unsigned int period_in_us;
+	/** Number of valid entries */
+	unsigned int num_entries;
+	/** Entries sorted by offset, @ref nrf_wifi_offload_sched_entry */
+	struct nrf_wifi_offload_sched_entry entries[NRF_WIFI_OFFLOAD_SCHED_MAX_ENTRIES];
+} __NRF_WIFI_PKD;
+
 /**
  * @brief This structure defines the command used for  offloading Raw tx
  *
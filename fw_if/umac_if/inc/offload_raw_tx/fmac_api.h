@@ -118,6 +118,26 @@ enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_start(struct nrf_wifi_fmac_dev_ctx
  */
 enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_stop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
 
+#if defined(NRF_WIFI_OFF_RAW_TX_SCHED) || defined(__DOXYGEN__)
+/**
+ * @brief Set the offloaded raw TX schedule.
+ * @param fmac_dev_ctx Pointer to the context of the RPU instance.
+ * @param sched Schedule of frame templates to be transmitted in each period.
+ *
+ * This function validates the schedule and hands the whole table to the
+ * RPU, which transmits every entry once per period at its offset with its
+ * own rate, power and channel. A table set while transmitting replaces the
+ * current one at the next period boundary, so a period is never transmitted
+ * with a mix of two schedules and the offloaded raw TX does not need to be
+ * stopped. Use nrf_wifi_off_raw_tx_fmac_start() to start transmitting.
+ *
+ * @retval NRF_WIFI_STATUS_SUCCESS On Success
+ * @retval NRF_WIFI_STATUS_FAIL On invalid schedule or if the RPU rejects it
+ */
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_sched_set(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							const struct nrf_wifi_off_raw_tx_sched *sched);
+#endif /* NRF_WIFI_OFF_RAW_TX_SCHED */
+
 /**
  * @brief Get the RF parameters to be programmed to the RPU.
  * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
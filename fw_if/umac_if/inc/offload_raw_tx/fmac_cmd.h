@@ -13,6 +13,7 @@
 #define __FMAC_CMD_OFF_RAW_TX_H__
 
 #include "common/fmac_cmd_common.h"
+#include "offload_raw_tx/fmac_structs.h"
 
 enum nrf_wifi_status umac_cmd_off_raw_tx_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 					      struct nrf_wifi_phy_rf_params *rf_params,
@@ -34,6 +35,11 @@ enum nrf_wifi_status umac_cmd_off_raw_tx_conf(struct nrf_wifi_fmac_dev_ctx *fmac
 					      struct nrf_wifi_offload_ctrl_params *offloaded_tx_params,
 					      struct nrf_wifi_offload_tx_ctrl *offload_tx_ctr);
 
+#ifdef NRF_WIFI_OFF_RAW_TX_SCHED
+enum nrf_wifi_status umac_cmd_off_raw_tx_sched(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					       const struct nrf_wifi_off_raw_tx_sched *sched);
+#endif /* NRF_WIFI_OFF_RAW_TX_SCHED */
+
 enum nrf_wifi_status umac_cmd_off_raw_tx_ctrl(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 					      unsigned char ctrl_type);
 
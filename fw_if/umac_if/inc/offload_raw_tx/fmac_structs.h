@@ -22,6 +22,42 @@
 #include "common/fmac_structs_common.h"
 #define NRF_WIFI_FMAC_PARAMS_RECV_TIMEOUT 100 /* ms */
 
+#if defined(NRF_WIFI_OFF_RAW_TX_SCHED) || defined(__DOXYGEN__)
+/** Maximum number of templates in an offloaded raw TX schedule. */
+#define NRF_WIFI_OFF_RAW_TX_SCHED_MAX_ENTRIES NRF_WIFI_OFFLOAD_SCHED_MAX_ENTRIES
+
+#ifndef NRF_WIFI_OFF_RAW_TX_SCHED_MIN_GAP_US
+/** Minimum time between two scheduled transmissions. */
+#define NRF_WIFI_OFF_RAW_TX_SCHED_MIN_GAP_US 1000
+#endif /* NRF_WIFI_OFF_RAW_TX_SCHED_MIN_GAP_US */
+
+/**
+ * @brief Offloaded raw TX schedule entry.
+ */
+struct nrf_wifi_off_raw_tx_sched_entry {
+	/** Frame template, rate and payload, see &struct nrf_wifi_offload_tx_ctrl. */
+	struct nrf_wifi_offload_tx_ctrl tx_params;
+	/** Transmit power in dBm (0 to 20). */
+	int tx_pwr;
+	/** Channel number. */
+	unsigned int channel_no;
+	/** Transmission time relative to the first entry of the period in us. */
+	unsigned int offset_us;
+};
+
+/**
+ * @brief Offloaded raw TX schedule table.
+ */
+struct nrf_wifi_off_raw_tx_sched {
+	/** Schedule period in us, every entry is transmitted once per period. */
+	unsigned int period_us;
+	/** Number of valid entries. */
+	unsigned int num_entries;
+	/** Entries sorted by offset, the first one at offset 0. */
+	struct nrf_wifi_off_raw_tx_sched_entry entries[NRF_WIFI_OFF_RAW_TX_SCHED_MAX_ENTRIES];
+};
+#endif /* NRF_WIFI_OFF_RAW_TX_SCHED */
+
 /**
  * @brief  Structure to hold per device context information for the UMAC IF layer.
  *
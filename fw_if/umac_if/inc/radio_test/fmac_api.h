@@ -113,6 +113,48 @@ enum nrf_wifi_status nrf_wifi_rt_fmac_rf_test_rx_cap(struct nrf_wifi_fmac_dev_ct
 						     unsigned char *timeout_status);
 
 
+/**
+ * @brief Start RF test capture in radio test mode and stream out the samples.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param rf_test_type Type of RF test to be performed.
+ * @param num_samples Number of RF test samples to capture.
+ * @param chunk_samples Number of samples per chunk, a multiple of
+ *        RF_TEST_CAP_CHUNK_ALIGN_SAMPLES.
+ * @param capture_timeout Capture timeout.
+ * @param lna_gain LNA gain value.
+ * @param bb_gain Baseband gain value.
+ * @param capture_status Capture status.
+ * @param cap_chunk_callbk_fn Callback function called for every chunk of the
+ *        capture, in order. Returning anything other than
+ *        NRF_WIFI_STATUS_SUCCESS aborts the read out.
+ * @param callbk_data Data passed to the callback function.
+ *
+ * This function is used to send a command to:
+ *	- The RPU firmware to start the RF test capture in radio test mode.
+ *
+ * Once the capture is done, it is read out of the RPU memory in chunks
+ * without the need for a buffer large enough for the whole capture. Two
+ * chunk buffers are used alternately, so a chunk passed to the callback
+ * stays valid until the callback for the chunk after the next one.
+ *
+ * @retval NRF_WIFI_STATUS_SUCCESS On Success
+ * @retval NRF_WIFI_STATUS_FAIL On failure to execute command
+ */
+enum nrf_wifi_status nrf_wifi_rt_fmac_rf_test_rx_cap_stream(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							    enum nrf_wifi_rf_test rf_test_type,
+							    unsigned short int num_samples,
+							    unsigned short int chunk_samples,
+							    unsigned short int capture_timeout,
+							    unsigned char lna_gain,
+							    unsigned char bb_gain,
+							    unsigned char *capture_status,
+							    enum nrf_wifi_status (*cap_chunk_callbk_fn)(void *callbk_data,
+													 void *chunk,
+													 unsigned int chunk_len,
+													 unsigned int offset),
+							    void *callbk_data);
+
+
 /**
  * @brief Start/Stop RF TX tone test in radio test mode.
  * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
@@ -107,6 +107,66 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_scan_res_get(void *fmac_dev_ctx,
 						unsigned char if_idx,
 						int scan_type);
 
+#if defined(NRF_WIFI_BSS_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Get the BSSs that changed in the host BSS cache.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param since_gen Cache generation returned by the previous call, 0 for all BSSs.
+ * @param bss_info Array of at least NRF_WIFI_BSS_CACHE_MAX_ENTRIES elements
+ *                 to be filled with the BSS information.
+ * @param num_bss Size of \p bss_info on input, number of valid elements on output.
+ * @param gen Current cache generation, to be passed in the next call.
+ * @param full Set when \p bss_info holds all the cached BSSs instead of a delta.
+ *
+ * The display scan results received from the RPU are merged into a host
+ * cache keyed by BSSID and channel. A BSS is reported as changed when it is
+ * new, when its SSID, security or capabilities change, when its smoothed
+ * signal strength moves by NRF_WIFI_BSS_CACHE_SIG_CHANGE_MBM or when it ages
+ * out of the cache. This lets the caller track the scan results without
+ * fetching the full list from the RPU with nrf_wifi_sys_fmac_scan_res_get().
+ *
+ * If part of the delta since \p since_gen was lost because the cache
+ * was full, all the cached BSSs are returned and \p full is set.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_get(void *fmac_dev_ctx,
+						     unsigned int since_gen,
+						     struct nrf_wifi_fmac_bss_info *bss_info,
+						     unsigned int *num_bss,
+						     unsigned int *gen,
+						     bool *full);
+
+/**
+ * @brief Pass only new and changed BSSs to the OS layer.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param enable Drop the unchanged BSSs from the display scan results.
+ *
+ * When enabled, the display scan result events are stripped of the BSSs the
+ * cache reports as unchanged before disp_scan_res_callbk_fn is called, and
+ * events left without BSSs are not passed on, except for the last event of
+ * the results. BSSs that aged out are only reported through
+ * nrf_wifi_sys_fmac_bss_cache_get(), which also returns the full list.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_delta_set(void *fmac_dev_ctx,
+							   bool enable);
+
+/**
+ * @brief Get the host BSS cache statistics of the last scan cycle.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Pointer to the statistics to be filled.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_stats_get(void *fmac_dev_ctx,
+							   struct nrf_wifi_fmac_bss_cache_stats *stats);
+#endif /* NRF_WIFI_BSS_CACHE */
+
 /**
  * @brief Issue abort of an ongoing scan to the RPU firmware.
  * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
@@ -465,6 +525,166 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_chg_sta(void *fmac_dev_ctx,
 					   unsigned char if_idx,
 					   struct nrf_wifi_umac_chg_sta_info *chg_sta_info);
 
+#if defined(NRF_WIFI_TX_STATUS_REPORT) || defined(__DOXYGEN__)
+/**
+ * @brief Get the TX status counters of a peer.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the interface on which the peer is connected.
+ * @param mac_addr MAC address of the peer.
+ * @param stats Pointer to the counters to be filled.
+ *
+ * This function is used to fetch the per access category count of frames
+ *	    the RPU firmware reported as sent or failed in TX done events
+ *	    since the peer was added.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL If the peer is not found
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_peer_tx_stats_get(void *fmac_dev_ctx,
+							 unsigned char if_idx,
+							 const unsigned char *mac_addr,
+							 struct nrf_wifi_fmac_peer_tx_stats *stats);
+#endif /* NRF_WIFI_TX_STATUS_REPORT */
+
+#if defined(NRF_WIFI_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the TX latency distribution of a peer.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the interface on which the peer is connected.
+ * @param mac_addr MAC address of the peer.
+ * @param ac Access category for which the latency is to be fetched.
+ * @param latency Array of NRF_WIFI_TX_LATENCY_SEG_MAX entries to be filled,
+ *		  indexed by &enum nrf_wifi_tx_latency_seg.
+ *
+ * This function is used to fetch percentile estimates of the TX latency
+ *	    segments measured on TX done events since the peer was added.
+ *	    Percentiles are interpolated from power of two buckets, so they
+ *	    are accurate to within a factor of two of the true value.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL If the peer is not found
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_peer_tx_latency_get(void *fmac_dev_ctx,
+							   unsigned char if_idx,
+							   const unsigned char *mac_addr,
+							   unsigned char ac,
+							   struct nrf_wifi_fmac_tx_latency *latency);
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+
+#if defined(NRF_WIFI_LINK_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get a snapshot of the RX link quality of the peers on an interface.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the interface.
+ * @param stats Array of MAX_PEERS entries to be filled.
+ * @param num_peers Number of entries filled in \p stats.
+ *
+ * This function is used to fetch the signal strength average, RX rate
+ *	    histogram and last seen time the host keeps for every peer from
+ *	    the data frames it receives, without a round trip to the RPU
+ *	    firmware. Peers from which no data frame has been received yet
+ *	    are not reported.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_link_stats_get(void *fmac_dev_ctx,
+						      unsigned char if_idx,
+						      struct nrf_wifi_fmac_peer_link_stats *stats,
+						      unsigned int *num_peers);
+#endif /* NRF_WIFI_LINK_STATS */
+
+#if defined(NRF_WIFI_MCAST_TO_UCAST) || defined(__DOXYGEN__)
+/**
+ * @brief Configure multicast to unicast conversion on a SoftAP interface.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the SoftAP interface.
+ * @param enable Send IP multicast frames as unicast copies to the peers.
+ * @param snoop Copy only to peers that joined the group, as learnt from
+ *	    the IGMP/MLD reports they send.
+ * @param max_peers Largest number of copies, frames with more receivers
+ *	    are sent as multicast.
+ *
+ * This function is used to stop IP multicast streams from being held
+ *	    behind the DTIM and sent at the basic rate when there are only a
+ *	    few receivers. Each copy is sent at the peer's rate and buffered
+ *	    per peer when the peer is in power save. Broadcast frames are not
+ *	    converted. Groups joined before snooping is enabled are only
+ *	    learnt on the next report of the peer.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_mc2uc_set(void *fmac_dev_ctx,
+						 unsigned char if_idx,
+						 bool enable,
+						 bool snoop,
+						 unsigned char max_peers);
+
+/**
+ * @brief Get the multicast to unicast conversion counters of a SoftAP interface.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the SoftAP interface.
+ * @param stats Counters to be filled.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_mc2uc_stats_get(void *fmac_dev_ctx,
+						       unsigned char if_idx,
+						       struct nrf_wifi_fmac_mc2uc_stats *stats);
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+
+#if defined(NRF_WIFI_UMAC_EVENT_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the processing statistics of the UMAC control events.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param stats Array of NRF_WIFI_UMAC_EVENT_STATS_MAX entries to be filled,
+ *	    indexed by the event ID less NRF_WIFI_UMAC_EVENT_UNSPECIFIED.
+ *
+ * This function is used to find the events whose handlers dominate the
+ *	    event processing time. The counters are updated from the event
+ *	    tasklet without locking, so the entry of an event being processed
+ *	    during the call may be one event behind.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_umac_event_stats_get(void *fmac_dev_ctx,
+							    struct nrf_wifi_fmac_umac_event_stats *stats);
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
+
+#if defined(NRF_WIFI_TX_SHAPING) || defined(__DOXYGEN__)
+/**
+ * @brief Limit the TX rate of a peer, or of every peer of an interface.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the interface.
+ * @param mac_addr MAC address of the peer, or NULL to set the limit of the
+ *	    current and future peers of the interface.
+ * @param ac Access category (BK, BE, VI or VO) to be limited.
+ * @param rate_kbps Long term rate in kbps, 0 to remove the limit.
+ * @param burst_bytes Number of bytes which may be sent back to back at a
+ *	    higher rate after the peer has been idle.
+ *
+ * This function is used to enforce per-client bandwidth contracts with a
+ *	    token bucket per peer and access category. Queues without tokens
+ *	    are skipped when picking the frames for a TX descriptor, so they
+ *	    do not hold descriptors other peers could use while waiting.
+ *	    Frames held back count towards the TX flow control watermarks.
+ *	    Multicast and frames sent during a power save service period
+ *	    are not limited.
+ *
+ *@retval	NRF_WIFI_STATUS_SUCCESS On success
+ *@retval	NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_tx_shaping_set(void *fmac_dev_ctx,
+						      unsigned char if_idx,
+						      const unsigned char *mac_addr,
+						      unsigned char ac,
+						      unsigned int rate_kbps,
+						      unsigned int burst_bytes);
+#endif /* NRF_WIFI_TX_SHAPING */
+
 
 
 /**
@@ -1052,6 +1272,58 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_rpu_recovery_callback(void *mac_dev_ctx,
 /** @endcond */
 #endif /* CONFIG_NRF_RPU_RECOVERY */
 
+#if defined(NRF_WIFI_RPU_RECOVERY_REPLAY) || defined(__DOXYGEN__)
+/**
+ * @brief Replay the configuration recorded before an RPU recovery.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ *
+ * The interface, MAC address, power save and AP configuration commands sent
+ * to the RPU are recorded (only the latest one of each kind per interface).
+ * This function re-sends them in their original order, so that after a
+ * firmware reload (nrf_wifi_sys_fmac_dev_deinit(), nrf_wifi_fmac_fw_load()
+ * and nrf_wifi_sys_fmac_dev_init() on the same device context) the RPU is
+ * brought back to the pre-recovery configuration without the VIFs having to
+ * be removed and added again by the OS layer. Station connections and keys
+ * are not restored, they need to be re-established by the supplicant.
+ *
+ * This function must not be called concurrently with other commands to the
+ * same device.
+ *
+ *@retval      NRF_WIFI_STATUS_SUCCESS On success
+ *@retval      NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_rpu_recovery_replay(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+/**
+ * @brief Perform a warm recovery of the RPU.
+ * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param fmac_fw Information about the FullMAC firmware(s) to be loaded.
+ *
+ * This function de-initializes the RPU instance, reloads the firmware,
+ * initializes the RPU instance again with the parameters of the last
+ * nrf_wifi_sys_fmac_dev_init() call and replays the recorded configuration
+ * using nrf_wifi_sys_fmac_rpu_recovery_replay(). The device and VIF contexts
+ * are kept, and the TX queues stopped by the flow control are woken up.
+ *
+ * It is meant to be called by the OS layer in response to
+ * rpu_recovery_callbk_fn, from a thread context of its own, since it waits
+ * for the RPU to boot.
+ *
+ *@retval      NRF_WIFI_STATUS_SUCCESS On success
+ *@retval      NRF_WIFI_STATUS_FAIL On failure
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_rpu_recovery_warm(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							 struct nrf_wifi_fmac_fw_info *fmac_fw);
+
+/** @cond INTERNAL_HIDDEN */
+void nrf_wifi_sys_fmac_recovery_cmd_record(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					   const void *params,
+					   int len);
+
+void nrf_wifi_sys_fmac_recovery_cmds_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+/** @endcond */
+#endif /* NRF_WIFI_RPU_RECOVERY_REPLAY */
+
 /**
  * @brief Get the RF parameters to be programmed to the RPU.
  * @param fmac_dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
@@ -1119,6 +1391,28 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_set_packet_filter(void *dev_ctx,
 							 unsigned char filter,
 							 unsigned char if_idx,
 							 unsigned short buffer_size);
+
+#if defined(NRF_WIFI_SNIFFER_FILTER) || defined(__DOXYGEN__)
+/**
+ * @brief Set a host sniffer filter program
+ * @param dev_ctx Pointer to the UMAC IF context for a RPU WLAN device.
+ * @param if_idx Index of the interface on which the filter is to be set.
+ * @param insns Filter program, see &struct nrf_wifi_sniffer_filter_insn.
+ * @param num_insns Number of instructions in \p insns, 0 to remove the filter.
+ *
+ * This function is used to verify and compile a filter program that is
+ * run on every monitor and promiscuous mode frame before it is handed to
+ * the sniffer callback. It complements the frame type filter set with
+ * nrf_wifi_sys_fmac_set_packet_filter(), frames are delivered only when
+ * both accept them.
+ *
+ * @return Command execution status
+ */
+enum nrf_wifi_status nrf_wifi_sys_fmac_set_sniffer_filter(void *dev_ctx,
+							  unsigned char if_idx,
+							  const struct nrf_wifi_sniffer_filter_insn *insns,
+							  unsigned int num_insns);
+#endif /* NRF_WIFI_SNIFFER_FILTER */
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
 
 #if defined(NRF70_UTIL) || defined(__DOXYGEN__)
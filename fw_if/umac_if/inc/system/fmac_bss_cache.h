@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief Header containing host BSS cache specific declarations for the
+ * FMAC IF Layer of the Wi-Fi driver.
+ */
+
+#ifndef __FMAC_BSS_CACHE_H__
+#define __FMAC_BSS_CACHE_H__
+
+#include "system/fmac_structs.h"
+
+#ifndef NRF_WIFI_BSS_CACHE_MAX_AGE_MS
+#define NRF_WIFI_BSS_CACHE_MAX_AGE_MS 30000
+#endif /* NRF_WIFI_BSS_CACHE_MAX_AGE_MS */
+
+#ifndef NRF_WIFI_BSS_CACHE_SIG_CHANGE_MBM
+#define NRF_WIFI_BSS_CACHE_SIG_CHANGE_MBM 500
+#endif /* NRF_WIFI_BSS_CACHE_SIG_CHANGE_MBM */
+
+/* Fixed point scale and weight (1 / 2^shift) of the signal strength average */
+#define NRF_WIFI_BSS_CACHE_SIG_SCALE 16
+#define NRF_WIFI_BSS_CACHE_SIG_AVG_SHIFT 2
+
+enum nrf_wifi_status nrf_wifi_fmac_bss_cache_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+void nrf_wifi_fmac_bss_cache_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+void nrf_wifi_fmac_bss_cache_scan_start(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+unsigned int nrf_wifi_fmac_bss_cache_update(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					    struct nrf_wifi_umac_event_new_scan_display_results *scan_res,
+					    unsigned int event_len);
+
+void nrf_wifi_fmac_bss_cache_delivered(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				       struct nrf_wifi_umac_event_new_scan_display_results *scan_res,
+				       unsigned int event_len);
+
+#endif /* __FMAC_BSS_CACHE_H__ */
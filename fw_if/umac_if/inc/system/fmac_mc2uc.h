@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief Header containing SoftAP multicast to unicast conversion specific
+ * declarations for the FMAC IF Layer of the Wi-Fi driver.
+ */
+
+#ifndef __FMAC_MC2UC_H__
+#define __FMAC_MC2UC_H__
+
+#include "system/fmac_structs.h"
+
+/* Snapshot of a receiving peer, taken under the TX lock */
+struct nrf_wifi_fmac_mc2uc_peer {
+	int peer_id;
+	unsigned char ra_addr[NRF_WIFI_ETH_ADDR_LEN];
+	bool qos_supported;
+};
+
+int nrf_wifi_fmac_mc2uc_peers_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  unsigned char if_idx,
+				  void *nwb,
+				  struct nrf_wifi_fmac_mc2uc_peer *peers);
+
+void nrf_wifi_fmac_mc2uc_rx_snoop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  void *nwb);
+
+#endif /* __FMAC_MC2UC_H__ */
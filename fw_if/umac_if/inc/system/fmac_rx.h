@@ -16,6 +16,13 @@
 #include "system/fmac_structs.h"
 #define RX_BUF_HEADROOM 4
 
+#if defined(NRF70_RX_WQ_ENABLED) || defined(__DOXYGEN__)
+/** Maximum number of RX events processed per RX tasklet run */
+#ifndef NRF70_RX_WQ_BUDGET
+#define NRF70_RX_WQ_BUDGET 8
+#endif /* NRF70_RX_WQ_BUDGET */
+#endif /* NRF70_RX_WQ_ENABLED */
+
 enum nrf_wifi_fmac_rx_cmd_type {
 	NRF_WIFI_FMAC_RX_CMD_TYPE_INIT,
 	NRF_WIFI_FMAC_RX_CMD_TYPE_DEINIT,
@@ -36,7 +43,7 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_cmd_send(struct nrf_wifi_fmac_dev_ctx *fma
 enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						    struct nrf_wifi_rx_buff *config);
 
-void nrf_wifi_fmac_rx_tasklet(void *data);
+void nrf_wifi_fmac_rx_tasklet(unsigned long data);
 
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
 unsigned long nrf_wifi_fmac_get_rx_buf_map_addr(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief Header containing sniffer filter specific declarations for the
+ * FMAC IF Layer of the Wi-Fi driver.
+ */
+
+#ifndef __FMAC_SNIFFER_FILTER_H__
+#define __FMAC_SNIFFER_FILTER_H__
+
+#include "system/fmac_structs.h"
+
+#if defined(NRF70_RAW_DATA_RX) || defined(NRF70_PROMISC_DATA_RX)
+enum nrf_wifi_status nrf_wifi_fmac_sniffer_filter_compile(const struct nrf_wifi_sniffer_filter_insn *insns,
+							  unsigned int num_insns,
+							  struct nrf_wifi_sniffer_filter_insn *prog);
+
+bool nrf_wifi_fmac_sniffer_filter_match(struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+					const unsigned char *frame,
+					unsigned int len,
+					struct raw_rx_pkt_header *raw_rx_hdr);
+#endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
+
+#endif /* __FMAC_SNIFFER_FILTER_H__ */
@@ -91,6 +91,78 @@ struct raw_rx_pkt_header {
 	/** Data rate of the packet (MCS or Legacy). */
 	unsigned char rate;
 };
+
+#if defined(NRF_WIFI_SNIFFER_FILTER) || defined(__DOXYGEN__)
+#ifndef NRF_WIFI_SNIFFER_FILTER_MAX_INSNS
+/** Maximum number of instructions in a sniffer filter program. */
+#define NRF_WIFI_SNIFFER_FILTER_MAX_INSNS 16
+#endif /* NRF_WIFI_SNIFFER_FILTER_MAX_INSNS */
+
+/**
+ * @brief Sniffer filter instruction operations.
+ */
+enum nrf_wifi_sniffer_filter_op {
+	/** Deliver the frame. */
+	NRF_WIFI_SNIFFER_FILTER_OP_ACCEPT,
+	/** Drop the frame. */
+	NRF_WIFI_SNIFFER_FILTER_OP_DROP,
+	/** Branch on (frame field & mask) == value, false past the frame end. */
+	NRF_WIFI_SNIFFER_FILTER_OP_FRAME_EQ,
+	/** Branch on (frame field & mask) > value, unsigned, false past the frame end. */
+	NRF_WIFI_SNIFFER_FILTER_OP_FRAME_GT,
+	/** Branch on (metadata & mask) == value. */
+	NRF_WIFI_SNIFFER_FILTER_OP_META_EQ,
+	/** Branch on metadata > value, signed. */
+	NRF_WIFI_SNIFFER_FILTER_OP_META_GT,
+	/** Invalid value. Used for error checks. */
+	NRF_WIFI_SNIFFER_FILTER_OP_MAX
+};
+
+/**
+ * @brief Receive metadata that sniffer filter instructions can test.
+ */
+enum nrf_wifi_sniffer_filter_meta {
+	/** Length of the 802.11 frame. */
+	NRF_WIFI_SNIFFER_FILTER_META_LEN,
+	/** Frequency in MHz. */
+	NRF_WIFI_SNIFFER_FILTER_META_FREQUENCY,
+	/** Signal strength in dBm. */
+	NRF_WIFI_SNIFFER_FILTER_META_SIGNAL,
+	/** Rate flags. */
+	NRF_WIFI_SNIFFER_FILTER_META_RATE_FLAGS,
+	/** Data rate (MCS or Legacy). */
+	NRF_WIFI_SNIFFER_FILTER_META_RATE,
+	/** Invalid value. Used for error checks. */
+	NRF_WIFI_SNIFFER_FILTER_META_MAX
+};
+
+/**
+ * @brief Sniffer filter instruction.
+ *
+ * A program is evaluated from the first instruction. Compare instructions
+ * skip \p jt instructions when the comparison holds and \p jf otherwise,
+ * so the program can only branch forward and always ends on an ACCEPT
+ * or DROP instruction.
+ */
+struct nrf_wifi_sniffer_filter_insn {
+	/** Operation, see &enum nrf_wifi_sniffer_filter_op. */
+	unsigned char op;
+	/** Number of frame bytes to load (1, 2 or 4), read in little endian
+	 *  order like the 802.11 header fields.
+	 */
+	unsigned char size;
+	/** Byte offset in the frame, or &enum nrf_wifi_sniffer_filter_meta. */
+	unsigned short offset;
+	/** Mask applied to the loaded value. */
+	unsigned int mask;
+	/** Value to compare with. */
+	unsigned int value;
+	/** Instructions to skip when the comparison holds. */
+	unsigned char jt;
+	/** Instructions to skip when the comparison does not hold. */
+	unsigned char jf;
+};
+#endif /* NRF_WIFI_SNIFFER_FILTER */
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
 
 /**
@@ -100,7 +172,10 @@ struct raw_rx_pkt_header {
  * the UMAC IF layer needs to invoke for various events.
  */
 struct nrf_wifi_fmac_callbk_fns {
-	/** Callback function to be called when RPU recovery is required. */
+	/** Callback function to be called when RPU recovery is required. With
+	 *  NRF_WIFI_RPU_RECOVERY_REPLAY the OS layer can defer a call to
+	 *  nrf_wifi_sys_fmac_rpu_recovery_warm() from it.
+	 */
 	void (*rpu_recovery_callbk_fn)(void *os_vif_ctx,
 		void *event_data,
 		unsigned int event_len);
@@ -271,6 +346,30 @@ struct nrf_wifi_fmac_callbk_fns {
 	/** Callback function to be called when rssi is to be processed from the received frame. */
 	void (*process_rssi_from_rx)(void *os_vif_ctx,
 				     signed short signal);
+
+	/** Callback function to be called when the frames pending for an access
+	 * category on an interface cross the high watermark, and the stack
+	 * should stop handing frames for that access category.
+	 */
+	void (*stop_queue_callbk_fn)(void *os_vif_ctx,
+				     unsigned char ac);
+
+	/** Callback function to be called when the frames pending for a stopped
+	 * access category on an interface drain below the low watermark.
+	 */
+	void (*wake_queue_callbk_fn)(void *os_vif_ctx,
+				     unsigned char ac);
+#if defined(NRF_WIFI_TX_STATUS_REPORT) || defined(__DOXYGEN__)
+	/** Callback function to be called with the TX status of every frame in
+	 *  a TX done event, \p frame is the position of the frame in the batch
+	 *  queued to the RPU for the peer and access category.
+	 */
+	void (*tx_frm_status_callbk_fn)(void *os_vif_ctx,
+					const unsigned char *ra_addr,
+					unsigned char ac,
+					unsigned int frame,
+					bool success);
+#endif /* NRF_WIFI_TX_STATUS_REPORT */
 #endif /* NRF70_STA_MODE */
 #if defined(NRF70_RAW_DATA_RX) || defined(NRF70_PROMISC_DATA_RX)
 	void (*sniffer_callbk_fn)(void *os_vif_ctx,
@@ -297,6 +396,178 @@ enum nrf_wifi_fmac_twt_state {
 #endif /* NRF70_STA_MODE */
 
 #if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX) || defined(__DOXYGEN__)
+#if defined(NRF_WIFI_TX_LATENCY_STATS) || defined(NRF_WIFI_TX_AMPDU_ADAPT) || \
+	defined(__DOXYGEN__)
+#ifndef NRF_WIFI_TX_LATENCY_PHY_TICKS_PER_US
+/** Resolution of the PHY TX timestamps reported in TX done events. */
+#define NRF_WIFI_TX_LATENCY_PHY_TICKS_PER_US 1
+#endif /* NRF_WIFI_TX_LATENCY_PHY_TICKS_PER_US */
+#endif /* NRF_WIFI_TX_LATENCY_STATS || NRF_WIFI_TX_AMPDU_ADAPT */
+
+#if defined(NRF_WIFI_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+/** Number of power of two latency buckets, the last one is open ended. */
+#define NRF_WIFI_TX_LATENCY_BUCKETS 24
+
+/**
+ * @brief TX latency segments measured for every TX done event.
+ */
+enum nrf_wifi_tx_latency_seg {
+	/** Host handing the frames to the RPU until the TX done event. */
+	NRF_WIFI_TX_LATENCY_SEG_TOTAL,
+	/** Queueing and channel access in the RPU, total minus air time. */
+	NRF_WIFI_TX_LATENCY_SEG_FW,
+	/** Frame sent at the PHY until the ACK was received. */
+	NRF_WIFI_TX_LATENCY_SEG_AIR,
+	/** Number of TX latency segments. */
+	NRF_WIFI_TX_LATENCY_SEG_MAX
+};
+
+/**
+ * @brief Streaming latency distribution for one TX latency segment.
+ */
+struct nrf_wifi_tx_latency_hist {
+	/** Number of samples with a latency of [2^(i-1), 2^i) us in bucket i. */
+	unsigned int buckets[NRF_WIFI_TX_LATENCY_BUCKETS];
+	/** Number of samples. */
+	unsigned int num_samples;
+	/** Largest latency seen in us. */
+	unsigned int max_us;
+};
+
+/**
+ * @brief TX latency summary reported by nrf_wifi_sys_fmac_peer_tx_latency_get().
+ */
+struct nrf_wifi_fmac_tx_latency {
+	/** Number of samples. */
+	unsigned int num_samples;
+	/** Median latency in us. */
+	unsigned int p50_us;
+	/** 90th percentile latency in us. */
+	unsigned int p90_us;
+	/** 99th percentile latency in us. */
+	unsigned int p99_us;
+	/** Largest latency seen in us. */
+	unsigned int max_us;
+};
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+
+#if defined(NRF_WIFI_LINK_STATS) || defined(__DOXYGEN__)
+/** Number of rate indices per mode in the RX rate histogram, legacy rates
+ *  are indexed in the order 1, 2, 5.5, 11, 6, 9, 12, 18, 24, 36, 48, 54 Mbps
+ *  and the other modes by MCS index.
+ */
+#define NRF_WIFI_LINK_STATS_RATES 12
+/** Weight of a new RX event in the signal strength average, as a shift. */
+#define NRF_WIFI_LINK_STATS_SIG_AVG_SHIFT 3
+/** Scale of the stored signal strength average. */
+#define NRF_WIFI_LINK_STATS_SIG_SCALE 16
+
+/**
+ * @brief RX link quality of a peer reported by nrf_wifi_sys_fmac_link_stats_get().
+ */
+struct nrf_wifi_fmac_peer_link_stats {
+	/** MAC address of the peer. */
+	unsigned char mac_addr[NRF_WIFI_ETH_ADDR_LEN];
+	/** Moving average of the RX signal strength, in the units of the RX events. */
+	int signal_avg;
+	/** Signal strength of the last RX event. */
+	int signal_last;
+	/** Number of data frames received. */
+	unsigned int rx_pkts;
+	/** Number of data frames received per mode (&enum rpu_tput_mode) and rate. */
+	unsigned int rate_hist[RPU_TPUT_MODE_MAX][NRF_WIFI_LINK_STATS_RATES];
+	/** Time since the last frame from the peer was received. */
+	unsigned int last_seen_ms;
+};
+
+/** @cond INTERNAL_HIDDEN */
+struct nrf_wifi_fmac_link_stats_entry {
+	unsigned char mac_addr[NRF_WIFI_ETH_ADDR_LEN];
+	bool valid;
+	/* Average signal strength scaled by NRF_WIFI_LINK_STATS_SIG_SCALE */
+	int signal_avg;
+	int signal_last;
+	unsigned int rx_pkts;
+	unsigned int rate_hist[RPU_TPUT_MODE_MAX][NRF_WIFI_LINK_STATS_RATES];
+	unsigned long last_rx_ms;
+};
+/** @endcond */
+#endif /* NRF_WIFI_LINK_STATS */
+
+#if defined(NRF_WIFI_UMAC_EVENT_STATS) || defined(__DOXYGEN__)
+/** Number of UMAC event IDs, from NRF_WIFI_UMAC_EVENT_UNSPECIFIED to the last
+ *  entry of &enum nrf_wifi_umac_events.
+ */
+#define NRF_WIFI_UMAC_EVENT_STATS_MAX (NRF_WIFI_UMAC_EVENT_GET_POWER_SAVE_INFO - \
+				       NRF_WIFI_UMAC_EVENT_UNSPECIFIED + 1)
+
+/**
+ * @brief Processing statistics of a UMAC event ID reported by
+ *	  nrf_wifi_sys_fmac_umac_event_stats_get().
+ */
+struct nrf_wifi_fmac_umac_event_stats {
+	/** Number of events passed to the handler. */
+	unsigned int count;
+	/** Number of events dropped for being shorter than the handler needs. */
+	unsigned int rejected;
+	/** Cumulative time spent in the handler in us. */
+	unsigned long long total_us;
+	/** Longest time spent in the handler in us. */
+	unsigned int max_us;
+};
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
+
+#if defined(NRF_WIFI_TX_AMPDU_ADAPT) || defined(__DOXYGEN__)
+#ifndef NRF_WIFI_TX_AMPDU_ADAPT_TARGET_US
+/** Airtime a TX token of one peer may take while other peers are waiting. */
+#define NRF_WIFI_TX_AMPDU_ADAPT_TARGET_US 2000
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT_TARGET_US */
+/** Weight of a new TX done event in the peer rate average, as a shift. */
+#define NRF_WIFI_TX_AMPDU_ADAPT_AVG_SHIFT 3
+
+/**
+ * @brief Per-peer and AC aggregation limits adapted from TX done events.
+ *
+ * All zero until the first TX done event for the peer and AC, in which
+ * case only the firmware limits apply.
+ */
+struct nrf_wifi_tx_aggr_ctrl {
+	/** Average bytes delivered per ms of airtime. */
+	unsigned int rate_bpms;
+	/** Maximum number of frames per TX token. */
+	unsigned int max_frames;
+	/** Maximum number of bytes per TX token. */
+	unsigned int max_bytes;
+};
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+
+#if defined(NRF_WIFI_MCAST_TO_UCAST) || defined(__DOXYGEN__)
+#ifndef NRF_WIFI_MC2UC_MAX_GROUPS
+/** Number of multicast groups tracked per peer when snooping IGMP/MLD. */
+#define NRF_WIFI_MC2UC_MAX_GROUPS 8
+#endif /* NRF_WIFI_MC2UC_MAX_GROUPS */
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+
+#if defined(NRF_WIFI_TX_SHAPING) || defined(__DOXYGEN__)
+/**
+ * @brief Token bucket shaping the frames of a peer and AC.
+ *
+ * Frames are sent while tokens are available and charged after being
+ * handed to the RPU, so the bucket goes negative by up to one aggregate
+ * which is then paid back before the queue is served again.
+ */
+struct nrf_wifi_tx_shaper {
+	/** Rate in kbps, 0 if the queue is not shaped. */
+	unsigned int rate_kbps;
+	/** Bucket depth in bytes. */
+	unsigned int burst_bytes;
+	/** Available bytes. */
+	int tokens;
+	/** Time of the last refill in us. */
+	unsigned long last_refill_us;
+};
+#endif /* NRF_WIFI_TX_SHAPING */
+
 /**
  * @brief Structure to hold peer context information.
  *
@@ -324,6 +595,32 @@ struct peers_info {
 	int ps_token_count;
 	/** Port authorized */
 	bool authorized;
+#if defined(NRF_WIFI_TX_STATUS_REPORT) || defined(__DOXYGEN__)
+	/** Per-AC number of frames the RPU reported as sent. */
+	unsigned int tx_ok[NRF_WIFI_FMAC_AC_MAX];
+	/** Per-AC number of frames the RPU reported as failed. */
+	unsigned int tx_fail[NRF_WIFI_FMAC_AC_MAX];
+#endif /* NRF_WIFI_TX_STATUS_REPORT */
+#if defined(NRF_WIFI_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+	/** Per-AC TX latency distributions. */
+	struct nrf_wifi_tx_latency_hist tx_latency[NRF_WIFI_FMAC_AC_MAX][NRF_WIFI_TX_LATENCY_SEG_MAX];
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+#if defined(NRF_WIFI_TX_AMPDU_ADAPT) || defined(__DOXYGEN__)
+	/** Per-AC aggregation limits. */
+	struct nrf_wifi_tx_aggr_ctrl aggr_ctrl[NRF_WIFI_FMAC_AC_MAX];
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+#if defined(NRF_WIFI_MCAST_TO_UCAST) || defined(__DOXYGEN__)
+	/** Multicast MAC addresses of the groups the peer has joined. */
+	unsigned char mc_groups[NRF_WIFI_MC2UC_MAX_GROUPS][NRF_WIFI_ETH_ADDR_LEN];
+	/** Number of valid entries in mc_groups. */
+	unsigned char num_mc_groups;
+	/** The peer joined more groups than tracked, it receives all groups. */
+	bool mc_groups_overflow;
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+#if defined(NRF_WIFI_TX_SHAPING) || defined(__DOXYGEN__)
+	/** Per-AC TX rate limits. */
+	struct nrf_wifi_tx_shaper shaper[NRF_WIFI_FMAC_AC_MAX];
+#endif /* NRF_WIFI_TX_SHAPING */
 };
 
 /**
@@ -356,10 +653,32 @@ struct tx_config {
 	 *  - Second four bits: Spare desc2 queue number.
 	 */
 	unsigned int spare_desc_queue_map;
+	/** Per-VIF bitmap of access categories for which the stack has been asked
+	 *  to stop queueing frames.
+	 */
+	unsigned char txq_stopped_map[MAX_NUM_VIFS];
 #if defined(NRF70_TX_DONE_WQ_ENABLED) || defined(__DOXYGEN__)
 	/** Queue for TX done tasklet. */
 	void *tx_done_tasklet_event_q;
 #endif /* NRF70_TX_DONE_WQ_ENABLED */
+#if defined(NRF_WIFI_TX_SHAPING) || defined(__DOXYGEN__)
+	/** Timer restarting TX once a shaped queue has earned tokens again. */
+	void *shaper_timer;
+	/** The shaper timer is pending. */
+	bool shaper_timer_armed;
+#endif /* NRF_WIFI_TX_SHAPING */
+#if defined(NRF_WIFI_TWT_PRESTAGE) || defined(__DOXYGEN__)
+	/** Timer building the TX commands ahead of the next TWT service period. */
+	void *twt_prestage_timer;
+	/** Negotiated TWT wake interval in us, 0 if not predicted. */
+	unsigned int twt_wake_interval_us;
+	/** Start of the last TWT service period in us, 0 if none seen yet. */
+	unsigned long twt_sp_start_us;
+	/** TX commands may be built ahead of the next service period, set
+	 *  between TWT_BLOCK_TX and TWT_UNBLOCK_TX.
+	 */
+	bool twt_prestage_allowed;
+#endif /* NRF_WIFI_TWT_PRESTAGE */
 };
 #endif /* NRF70_STA_MODE || NRF70_RAW_DATA_RX */
 
@@ -458,6 +777,135 @@ struct raw_tx_stats {
 };
 #endif /* NRF70_RAW_DATA_TX */
 
+#if defined(NRF_WIFI_TX_STATUS_REPORT) || defined(__DOXYGEN__)
+/**
+ * @brief Per-peer TX status counters reported by nrf_wifi_sys_fmac_peer_tx_stats_get().
+ */
+struct nrf_wifi_fmac_peer_tx_stats {
+	/** Per-AC number of frames the RPU reported as sent. */
+	unsigned int tx_ok[NRF_WIFI_FMAC_AC_MAX];
+	/** Per-AC number of frames the RPU reported as failed. */
+	unsigned int tx_fail[NRF_WIFI_FMAC_AC_MAX];
+};
+#endif /* NRF_WIFI_TX_STATUS_REPORT */
+
+#if defined(NRF_WIFI_MCAST_TO_UCAST) || defined(__DOXYGEN__)
+/**
+ * @brief Multicast to unicast conversion counters of a SoftAP VIF.
+ */
+struct nrf_wifi_fmac_mc2uc_stats {
+	/** Multicast frames sent as unicast copies. */
+	unsigned int converted;
+	/** Unicast copies queued for transmission. */
+	unsigned int copies;
+	/** Multicast frames sent as multicast, as they had too many receivers. */
+	unsigned int fallback;
+	/** Multicast frames dropped, as no peer had joined the group. */
+	unsigned int no_member;
+	/** Unicast copies that could not be allocated or queued. */
+	unsigned int copy_fail;
+	/** IGMP/MLD group joins seen from peers. */
+	unsigned int joins;
+	/** IGMP/MLD group leaves seen from peers. */
+	unsigned int leaves;
+};
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+
+#if defined(NRF_WIFI_BSS_CACHE) || defined(__DOXYGEN__)
+#ifndef NRF_WIFI_BSS_CACHE_MAX_ENTRIES
+/** Maximum number of BSSs held in the host BSS cache. */
+#define NRF_WIFI_BSS_CACHE_MAX_ENTRIES 32
+#endif /* NRF_WIFI_BSS_CACHE_MAX_ENTRIES */
+
+/**
+ * @brief BSS information reported by nrf_wifi_sys_fmac_bss_cache_get().
+ */
+struct nrf_wifi_fmac_bss_info {
+	/** Latest scan result for the BSS, with a smoothed signal strength. */
+	struct umac_display_results res;
+	/** Time since the BSS was last seen in a scan result. */
+	unsigned int age_ms;
+	/** Cache generation in which the BSS last changed. */
+	unsigned int gen;
+	/** The BSS has aged out of the cache, only BSSID and channel are valid. */
+	bool removed;
+};
+
+/**
+ * @brief Host BSS cache statistics for the last completed scan cycle.
+ */
+struct nrf_wifi_fmac_bss_cache_stats {
+	/** Number of scan cycles seen since the cache was created. */
+	unsigned int scan_cycles;
+	/** Number of scan result events received from the RPU. */
+	unsigned int events;
+	/** Number of scan result bytes received from the RPU. */
+	unsigned int bytes;
+	/** Number of BSS entries in the scan result events. */
+	unsigned int bss_reported;
+	/** Number of BSSs that were new, changed or removed. */
+	unsigned int bss_changed;
+	/** Number of display scan result events passed to the OS layer. */
+	unsigned int os_events;
+	/** Number of display scan result bytes passed to the OS layer. */
+	unsigned int os_bytes;
+	/** Number of BSS entries passed to the OS layer. */
+	unsigned int os_bss;
+};
+
+/** @cond INTERNAL_HIDDEN */
+enum nrf_wifi_fmac_bss_cache_state {
+	NRF_WIFI_BSS_CACHE_ENTRY_FREE,
+	NRF_WIFI_BSS_CACHE_ENTRY_VALID,
+	NRF_WIFI_BSS_CACHE_ENTRY_REMOVED,
+};
+
+struct nrf_wifi_fmac_bss_cache_entry {
+	struct umac_display_results res;
+	/* Smoothed signal strength scaled by NRF_WIFI_BSS_CACHE_SIG_SCALE */
+	int sig_avg;
+	/* Signal strength reported at the last change */
+	int sig_rep;
+	unsigned long last_seen_ms;
+	unsigned int gen;
+	enum nrf_wifi_fmac_bss_cache_state state;
+};
+
+struct nrf_wifi_fmac_bss_cache {
+	void *lock;
+	/* Only new and changed BSSs are passed to the OS layer */
+	bool delta_only;
+	unsigned int gen;
+	/* Deltas from generations older than this are incomplete */
+	unsigned int resync_gen;
+	struct nrf_wifi_fmac_bss_cache_stats cur_stats;
+	struct nrf_wifi_fmac_bss_cache_stats last_stats;
+	struct nrf_wifi_fmac_bss_cache_entry entries[NRF_WIFI_BSS_CACHE_MAX_ENTRIES];
+};
+/** @endcond */
+#endif /* NRF_WIFI_BSS_CACHE */
+
+#ifdef NRF_WIFI_RPU_RECOVERY_REPLAY
+/** @cond INTERNAL_HIDDEN */
+/* Parameters of the last nrf_wifi_sys_fmac_dev_init(), used to bring the
+ * RPU back up during a warm recovery.
+ */
+struct nrf_wifi_fmac_recovery_init_params {
+	bool valid;
+#ifdef NRF_WIFI_LOW_POWER
+	int sleep_type;
+#endif /* NRF_WIFI_LOW_POWER */
+	unsigned int phy_calib;
+	enum op_band op_band;
+	bool beamforming;
+	struct nrf_wifi_tx_pwr_ctrl_params tx_pwr_ctrl_params;
+	struct nrf_wifi_tx_pwr_ceil_params tx_pwr_ceil_params;
+	struct nrf_wifi_board_params board_params;
+	unsigned char country_code[NRF_WIFI_COUNTRY_CODE_LEN];
+};
+/** @endcond */
+#endif /* NRF_WIFI_RPU_RECOVERY_REPLAY */
+
 /**
  * @brief Structure to hold per device context information for the UMAC IF layer.
  *
@@ -472,6 +920,8 @@ struct nrf_wifi_sys_fmac_dev_ctx {
 	void *rx_tasklet;
 	/** Queue for RX tasklet. */
 	void *rx_tasklet_event_q;
+	/** RX tasklet has been scheduled and not yet drained the queue. */
+	bool rx_tasklet_scheduled;
 #endif /* NRF70_RX_WQ_ENABLED */
 	/** Host statistics. */
 	struct rpu_host_stats host_stats;
@@ -493,12 +943,36 @@ struct nrf_wifi_sys_fmac_dev_ctx {
 #if defined(NRF70_TX_DONE_WQ_ENABLED)
 	/** Tasklet for TX done. */
 	void *tx_done_tasklet;
+	/** TX done tasklet has been scheduled and not yet drained the queue. */
+	bool tx_done_tasklet_scheduled;
 #endif /* NRF70_TX_DONE_WQ_ENABLED */
+#if defined(NRF_WIFI_LINK_STATS) || defined(__DOXYGEN__)
+	/** Per-peer RX link quality, indexed by peer ID and updated under the RX lock. */
+	struct nrf_wifi_fmac_link_stats_entry link_stats[MAX_PEERS];
+#endif /* NRF_WIFI_LINK_STATS */
 #endif /* NRF70_STA_MODE */
 #ifdef NRF70_RAW_DATA_TX
 	struct raw_tx_pkt_header raw_tx_config;
 	struct raw_tx_stats raw_pkt_stats;
 #endif /* NRF70_RAW_DATA_TX */
+#if defined(NRF_WIFI_RPU_RECOVERY_REPLAY) || defined(__DOXYGEN__)
+	/** Configuration commands to be replayed after an RPU recovery. */
+	void *recovery_cmd_list;
+	/** Lock for the recovery command list. */
+	void *recovery_cmd_lock;
+	/** Recovery commands are being replayed. */
+	bool recovery_replay_active;
+	/** Device initialization parameters for a warm recovery. */
+	struct nrf_wifi_fmac_recovery_init_params recovery_init_params;
+#endif /* NRF_WIFI_RPU_RECOVERY_REPLAY */
+#if defined(NRF_WIFI_BSS_CACHE) || defined(__DOXYGEN__)
+	/** Host cache of the display scan results. */
+	struct nrf_wifi_fmac_bss_cache bss_cache;
+#endif /* NRF_WIFI_BSS_CACHE */
+#if defined(NRF_WIFI_UMAC_EVENT_STATS) || defined(__DOXYGEN__)
+	/** Per event ID processing statistics, updated from the event tasklet. */
+	struct nrf_wifi_fmac_umac_event_stats umac_event_stats[NRF_WIFI_UMAC_EVENT_STATS_MAX];
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
 };
 
 /**
@@ -538,6 +1012,27 @@ struct nrf_wifi_fmac_vif_ctx {
 	/** Promiscuous mode setting */
 	bool promisc_mode;
 #endif /* NRF70_PROMISC_DATA_RX */
+#if (defined(NRF70_RAW_DATA_RX) || defined(NRF70_PROMISC_DATA_RX)) && \
+	defined(NRF_WIFI_SNIFFER_FILTER)
+	/** Compiled sniffer filter program */
+	struct nrf_wifi_sniffer_filter_insn sniffer_filter[NRF_WIFI_SNIFFER_FILTER_MAX_INSNS];
+	/** Number of instructions in the sniffer filter, 0 if no filter is set */
+	unsigned char sniffer_filter_len;
+#endif /* (NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX) && NRF_WIFI_SNIFFER_FILTER */
+#if defined(NRF_WIFI_MCAST_TO_UCAST) || defined(__DOXYGEN__)
+	/** Send multicast frames as unicast copies to each peer. */
+	bool mc2uc_enabled;
+	/** Copy only to peers that joined the group (IGMP/MLD snooping). */
+	bool mc2uc_snoop;
+	/** Above this number of receivers frames are sent as multicast. */
+	unsigned char mc2uc_max_peers;
+	/** Multicast to unicast conversion counters. */
+	struct nrf_wifi_fmac_mc2uc_stats mc2uc_stats;
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+#if defined(NRF_WIFI_TX_SHAPING) || defined(__DOXYGEN__)
+	/** Per-AC TX rate limits applied to peers added to the VIF. */
+	struct nrf_wifi_tx_shaper tx_shaper[NRF_WIFI_FMAC_AC_MAX];
+#endif /* NRF_WIFI_TX_SHAPING */
 };
 
 /**
@@ -39,6 +39,40 @@
  */
 #define SPARE_DESC_Q_MAP_SIZE 4
 
+#if defined(NRF70_TX_DONE_WQ_ENABLED) || defined(__DOXYGEN__)
+/** @brief Maximum number of TX done events processed per TX done tasklet run. */
+#ifndef NRF70_TX_DONE_WQ_BUDGET
+#define NRF70_TX_DONE_WQ_BUDGET 8
+#endif /* NRF70_TX_DONE_WQ_BUDGET */
+#endif /* NRF70_TX_DONE_WQ_ENABLED */
+
+#if defined(NRF_WIFI_TWT_PRESTAGE) || defined(__DOXYGEN__)
+/** @brief Time in ms ahead of a predicted TWT service period at which TX
+ * commands are built.
+ */
+#ifndef NRF_WIFI_TWT_PRESTAGE_LEAD_MS
+#define NRF_WIFI_TWT_PRESTAGE_LEAD_MS 2
+#endif /* NRF_WIFI_TWT_PRESTAGE_LEAD_MS */
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+
+/**
+ * @brief The number of frames pending for an access category on an
+ * interface at which the stack is asked to stop queueing frames for that
+ * access category. Must be below NRF70_MAX_TX_PENDING_QLEN so that the stack
+ * is stopped before any pending queue overflows.
+ */
+#ifndef NRF70_TX_FLOW_CTRL_HIGH_WM
+#define NRF70_TX_FLOW_CTRL_HIGH_WM ((NRF70_MAX_TX_PENDING_QLEN * 3) / 4)
+#endif /* NRF70_TX_FLOW_CTRL_HIGH_WM */
+
+/**
+ * @brief The number of pending frames below which a stopped access category
+ * is woken up.
+ */
+#ifndef NRF70_TX_FLOW_CTRL_LOW_WM
+#define NRF70_TX_FLOW_CTRL_LOW_WM (NRF70_MAX_TX_PENDING_QLEN / 4)
+#endif /* NRF70_TX_FLOW_CTRL_LOW_WM */
+
 /**
  * @brief The status of a TX operation performed by the RPU driver.
  */
@@ -62,6 +96,24 @@ struct tx_pkt_info {
 	void *pkt;
 	/** Peer ID. */
 	unsigned int peer_id;
+#if defined(NRF_WIFI_TX_LATENCY_STATS) || defined(__DOXYGEN__)
+	/** Host time at which the frames were handed to the RPU. */
+	unsigned long tx_start_us;
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+#if defined(NRF_WIFI_TX_AMPDU_ADAPT) || defined(__DOXYGEN__)
+	/** Number of bytes in the TX token. */
+	unsigned int aggr_bytes;
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+#if defined(NRF_WIFI_TWT_PRESTAGE) || defined(__DOXYGEN__)
+	/** TX command built ahead of the next TWT service period. */
+	struct host_rpu_msg *twt_staged_cmd;
+	/** Length of the staged TX command. */
+	unsigned int twt_staged_len;
+	/** Access category of the held frames. */
+	unsigned char twt_ac;
+	/** The frames are held until the RPU is awake. */
+	bool twt_held;
+#endif /* NRF_WIFI_TWT_PRESTAGE */
 };
 
 #ifdef NRF70_RAW_DATA_TX
@@ -174,6 +226,71 @@ unsigned int tx_buff_req_free(struct nrf_wifi_fmac_dev_ctx *fmac_ctx,
 		unsigned int desc,
 		unsigned char *ac);
 
+/**
+ * @brief Wake the stopped access categories whose pending frames have
+ * drained below the low watermark, called with the TX lock held.
+ *
+ * @param fmac_dev_ctx Pointer to the FMAC device context.
+ */
+void tx_flow_ctrl_wake(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+
+/**
+ * @brief Wake every stopped access category of an interface which is going
+ * away, called with the TX lock held.
+ *
+ * @param fmac_dev_ctx Pointer to the FMAC device context.
+ * @param if_idx Index of the interface.
+ */
+void tx_flow_ctrl_vif_reset(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			    unsigned char if_idx);
+
+#ifdef NRF_WIFI_TX_SHAPING
+/**
+ * @brief Set the rate limit of a token bucket and fill it.
+ *
+ * @param shaper Pointer to the token bucket.
+ * @param rate_kbps Rate in kbps, 0 to disable shaping.
+ * @param burst_bytes Bucket depth in bytes.
+ */
+void tx_shaper_init(struct nrf_wifi_tx_shaper *shaper,
+		    unsigned int rate_kbps,
+		    unsigned int burst_bytes);
+
+/**
+ * @brief Offer a TX descriptor to every AC, called with the TX lock held.
+ *
+ * Nothing is sent while the RPU is in TWT sleep.
+ *
+ * @param fmac_dev_ctx Pointer to the FMAC device context.
+ */
+void tx_shaper_kick(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx);
+#endif /* NRF_WIFI_TX_SHAPING */
+
+#ifdef NRF_WIFI_TWT_PRESTAGE
+/**
+ * @brief Update the TWT agreement used to predict service periods.
+ *
+ * On teardown the staged and held TX tokens are posted right away.
+ *
+ * @param fmac_dev_ctx Pointer to the FMAC device context.
+ * @param twt_info TWT parameters of the agreement, NULL on teardown.
+ */
+void tx_twt_params_set(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+		       struct nrf_wifi_umac_config_twt_info *twt_info);
+
+/**
+ * @brief Handle a TWT sleep indication from the RPU.
+ *
+ * On TWT_BLOCK_TX the TX commands are scheduled to be built shortly before
+ * the next service period, on TWT_UNBLOCK_TX the held ones are posted.
+ *
+ * @param fmac_dev_ctx Pointer to the FMAC device context.
+ * @param type TWT_BLOCK_TX or TWT_UNBLOCK_TX.
+ */
+void tx_twt_sleep_update(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			 unsigned int type);
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+
 /** @} */
 
 #endif /* __FMAC_TX_H__ */
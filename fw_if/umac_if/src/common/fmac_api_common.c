@@ -14,6 +14,15 @@
 #include "common/fmac_util.h"
 #include "common/fmac_cmd_common.h"
 #include "util.h"
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+#include "sha256.h"
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
+#if defined(NRF70_SYSTEM_MODE) && defined(NRF_WIFI_RPU_RECOVERY_REPLAY)
+#include "system/fmac_api.h"
+#endif /* NRF70_SYSTEM_MODE && NRF_WIFI_RPU_RECOVERY_REPLAY */
+#if defined(NRF70_SYSTEM_MODE) && defined(NRF_WIFI_BSS_CACHE)
+#include "system/fmac_bss_cache.h"
+#endif /* NRF70_SYSTEM_MODE && NRF_WIFI_BSS_CACHE */
 
 
 void nrf_wifi_fmac_deinit(struct nrf_wifi_fmac_priv *fpriv)
@@ -26,6 +35,17 @@ void nrf_wifi_fmac_deinit(struct nrf_wifi_fmac_priv *fpriv)
 
 void nrf_wifi_fmac_dev_rem(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 {
+#if defined(NRF70_SYSTEM_MODE) && defined(NRF_WIFI_RPU_RECOVERY_REPLAY)
+	if (fmac_dev_ctx->op_mode == NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_sys_fmac_recovery_cmds_free(fmac_dev_ctx);
+	}
+#endif /* NRF70_SYSTEM_MODE && NRF_WIFI_RPU_RECOVERY_REPLAY */
+#if defined(NRF70_SYSTEM_MODE) && defined(NRF_WIFI_BSS_CACHE)
+	if (fmac_dev_ctx->op_mode == NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_fmac_bss_cache_deinit(fmac_dev_ctx);
+	}
+#endif /* NRF70_SYSTEM_MODE && NRF_WIFI_BSS_CACHE */
+
 	nrf_wifi_hal_dev_rem(fmac_dev_ctx->hal_dev_ctx);
 
 	nrf_wifi_osal_mem_free(fmac_dev_ctx);
@@ -34,12 +54,14 @@ void nrf_wifi_fmac_dev_rem(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 struct nrf_wifi_proc {
 	const enum RPU_PROC_TYPE type;
 	const char *name;
-	bool is_patch_present;
 };
 
-struct nrf_wifi_proc wifi_proc[] = {
-	{RPU_PROC_TYPE_MCU_LMAC, "LMAC", true},
-	{RPU_PROC_TYPE_MCU_UMAC, "UMAC", true},
+/* Only constant data here, the per boot state lives in the device context
+ * so that multiple devices can be loaded and booted concurrently.
+ */
+static const struct nrf_wifi_proc wifi_proc[] = {
+	{RPU_PROC_TYPE_MCU_LMAC, "LMAC"},
+	{RPU_PROC_TYPE_MCU_UMAC, "UMAC"},
 };
 
 static int nrf_wifi_patch_version_compat(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
@@ -229,6 +251,33 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_parse(struct nrf_wifi_fmac_dev_ctx *fmac_d
 		offset += sizeof(struct nrf70_fw_image) + image->len;
 	}
 
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+	fw_info->hash = NULL;
+	fw_info->hash_data = NULL;
+	fw_info->hash_data_len = 0;
+
+	for (offset = 0; offset < NRF_WIFI_PATCH_HASH_LEN; offset++) {
+		if (info->hash[offset]) {
+			break;
+		}
+	}
+
+	if (offset == NRF_WIFI_PATCH_HASH_LEN) {
+		nrf_wifi_osal_log_dbg("No FW image hash, skipping verification");
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	if (info->len > fw_size - sizeof(struct nrf70_fw_image_info)) {
+		nrf_wifi_osal_log_err("Invalid fw_size: %d for hashed len: %d",
+				      fw_size, info->len);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	fw_info->hash = info->hash;
+	fw_info->hash_data = info->data;
+	fw_info->hash_data_len = info->len;
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
+
 	return NRF_WIFI_STATUS_SUCCESS;
 }
 
@@ -259,7 +308,7 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_boot(struct nrf_wifi_fmac_dev_ctx *fmac_de
 	for (i = 0; i < ARRAY_SIZE(wifi_proc); i++) {
 		status = nrf_wifi_hal_fw_patch_boot(fmac_dev_ctx->hal_dev_ctx,
 						    wifi_proc[i].type,
-						    wifi_proc[i].is_patch_present);
+						    !fmac_dev_ctx->is_patch_absent[wifi_proc[i].type]);
 
 		if (status != NRF_WIFI_STATUS_SUCCESS) {
 			nrf_wifi_osal_log_err("%s: %s processor ROM boot failed",
@@ -293,21 +342,172 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_chunk_load(struct nrf_wifi_fmac_dev_ctx *f
 }
 
 
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+struct nrf_wifi_fw_hash_ctx {
+	struct nrf_wifi_utils_sha256_ctx sha256_ctx;
+	struct nrf_wifi_fmac_fw_load_stats *load_stats;
+	/* Next byte of the FW image data to be hashed */
+	const unsigned char *next;
+	/* End of the FW image data covered by the hash */
+	const unsigned char *end;
+	bool invalid;
+};
+
+
+/* The patches are loaded in the same order as they are laid out in the FW
+ * image, so the hash is computed on the fly from the chunks being written to
+ * the RPU. The image headers in between the patches are hashed as gaps.
+ */
+static void fw_hash_chunk_callbk_fn(void *callbk_data,
+				    const void *chunk,
+				    unsigned int chunk_len)
+{
+	struct nrf_wifi_fw_hash_ctx *hash_ctx = callbk_data;
+	const unsigned char *chunk_start = chunk;
+	unsigned long start_time_us = 0;
+
+	if (hash_ctx->invalid) {
+		return;
+	}
+
+	if ((chunk_start < hash_ctx->next) ||
+	    (chunk_len > (unsigned long)(hash_ctx->end - chunk_start))) {
+		hash_ctx->invalid = true;
+		return;
+	}
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+
+	if (chunk_start > hash_ctx->next) {
+		nrf_wifi_utils_sha256_update(&hash_ctx->sha256_ctx,
+					     hash_ctx->next,
+					     chunk_start - hash_ctx->next);
+	}
+
+	nrf_wifi_utils_sha256_update(&hash_ctx->sha256_ctx,
+				     chunk_start,
+				     chunk_len);
+
+	hash_ctx->next = chunk_start + chunk_len;
+
+	hash_ctx->load_stats->hash_us += nrf_wifi_osal_time_elapsed_us(start_time_us);
+}
+
+
+static void fw_hash_start(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			  struct nrf_wifi_fmac_fw_info *fmac_fw,
+			  struct nrf_wifi_fw_hash_ctx *hash_ctx)
+{
+	struct nrf_wifi_hal_dev_ctx *hal_dev_ctx = fmac_dev_ctx->hal_dev_ctx;
+
+	if (!fmac_fw->hash) {
+		return;
+	}
+
+	nrf_wifi_utils_sha256_init(&hash_ctx->sha256_ctx);
+	hash_ctx->load_stats = &fmac_dev_ctx->fw_load_stats;
+	hash_ctx->next = fmac_fw->hash_data;
+	hash_ctx->end = hash_ctx->next + fmac_fw->hash_data_len;
+	hash_ctx->invalid = false;
+
+	hal_dev_ctx->fw_patch_chunk_callbk_data = hash_ctx;
+	hal_dev_ctx->fw_patch_chunk_callbk_fn = fw_hash_chunk_callbk_fn;
+}
+
+
+static enum nrf_wifi_status fw_hash_verify(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					   struct nrf_wifi_fmac_fw_info *fmac_fw,
+					   struct nrf_wifi_fw_hash_ctx *hash_ctx)
+{
+	struct nrf_wifi_hal_dev_ctx *hal_dev_ctx = fmac_dev_ctx->hal_dev_ctx;
+	unsigned char digest[NRF_WIFI_SHA256_DIGEST_LEN];
+	unsigned long start_time_us = 0;
+
+	if (!fmac_fw->hash) {
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	hal_dev_ctx->fw_patch_chunk_callbk_fn = NULL;
+	hal_dev_ctx->fw_patch_chunk_callbk_data = NULL;
+
+	if (hash_ctx->invalid) {
+		nrf_wifi_osal_log_err("%s: FW patches not loaded from the hashed image",
+				      __func__);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+
+	/* Hash whatever was not loaded (trailing headers, absent patches) */
+	if (hash_ctx->end > hash_ctx->next) {
+		nrf_wifi_utils_sha256_update(&hash_ctx->sha256_ctx,
+					     hash_ctx->next,
+					     hash_ctx->end - hash_ctx->next);
+	}
+
+	nrf_wifi_utils_sha256_final(&hash_ctx->sha256_ctx,
+				    digest);
+
+	hash_ctx->load_stats->hash_us += nrf_wifi_osal_time_elapsed_us(start_time_us);
+
+	if (nrf_wifi_osal_mem_cmp(digest,
+				  fmac_fw->hash,
+				  NRF_WIFI_PATCH_HASH_LEN) != 0) {
+		nrf_wifi_osal_log_err("%s: FW image hash mismatch",
+				      __func__);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	nrf_wifi_osal_log_dbg("%s: FW image hash verified, %d bytes in %d us",
+			      __func__,
+			      fmac_fw->hash_data_len,
+			      hash_ctx->load_stats->hash_us);
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
+
+
 enum nrf_wifi_status nrf_wifi_fmac_fw_load(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 					   struct nrf_wifi_fmac_fw_info *fmac_fw)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_fw_load_stats *load_stats = &fmac_dev_ctx->fw_load_stats;
+	unsigned long start_time_us = 0;
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+	struct nrf_wifi_fw_hash_ctx hash_ctx;
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
+
+	nrf_wifi_osal_mem_set(load_stats,
+			      0,
+			      sizeof(*load_stats));
+
+	fmac_dev_ctx->is_patch_absent[RPU_PROC_TYPE_MCU_LMAC] = false;
+	fmac_dev_ctx->is_patch_absent[RPU_PROC_TYPE_MCU_UMAC] = false;
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
 
 	status = nrf_wifi_fmac_fw_reset(fmac_dev_ctx);
+
+	load_stats->reset_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: FW reset failed",
 				      __func__);
 		goto out;
 	}
 
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+	fw_hash_start(fmac_dev_ctx,
+		      fmac_fw,
+		      &hash_ctx);
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
+
 	/* Load the UMAC patches if available */
 	if (fmac_fw->umac_patch_pri.data && fmac_fw->umac_patch_pri.size &&
 	    fmac_fw->umac_patch_sec.data && fmac_fw->umac_patch_sec.size) {
+		start_time_us = nrf_wifi_osal_time_get_curr_us();
+
 		status = nrf_wifi_hal_fw_patch_load(fmac_dev_ctx->hal_dev_ctx,
 						    RPU_PROC_TYPE_MCU_UMAC,
 						    fmac_fw->umac_patch_pri.data,
@@ -315,6 +515,8 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_load(struct nrf_wifi_fmac_dev_ctx *fmac_de
 						    fmac_fw->umac_patch_sec.data,
 						    fmac_fw->umac_patch_sec.size);
 
+		load_stats->umac_load_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
 		if (status != NRF_WIFI_STATUS_SUCCESS) {
 			nrf_wifi_osal_log_err("%s: UMAC patch load failed",
 					      __func__);
@@ -324,12 +526,14 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_load(struct nrf_wifi_fmac_dev_ctx *fmac_de
 					      __func__);
 		}
 	} else {
-		wifi_proc[1].is_patch_present = false;
+		fmac_dev_ctx->is_patch_absent[RPU_PROC_TYPE_MCU_UMAC] = true;
 	}
 
 	/* Load the LMAC patches if available */
 	if (fmac_fw->lmac_patch_pri.data && fmac_fw->lmac_patch_pri.size &&
 	    fmac_fw->lmac_patch_sec.data && fmac_fw->lmac_patch_sec.size) {
+		start_time_us = nrf_wifi_osal_time_get_curr_us();
+
 		status = nrf_wifi_hal_fw_patch_load(fmac_dev_ctx->hal_dev_ctx,
 						    RPU_PROC_TYPE_MCU_LMAC,
 						    fmac_fw->lmac_patch_pri.data,
@@ -337,6 +541,8 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_load(struct nrf_wifi_fmac_dev_ctx *fmac_de
 						    fmac_fw->lmac_patch_sec.data,
 						    fmac_fw->lmac_patch_sec.size);
 
+		load_stats->lmac_load_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
 		if (status != NRF_WIFI_STATUS_SUCCESS) {
 			nrf_wifi_osal_log_err("%s: LMAC patch load failed",
 					      __func__);
@@ -346,10 +552,25 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_load(struct nrf_wifi_fmac_dev_ctx *fmac_de
 					      __func__);
 		}
 	} else {
-		wifi_proc[0].is_patch_present = false;
+		fmac_dev_ctx->is_patch_absent[RPU_PROC_TYPE_MCU_LMAC] = true;
+	}
+
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+	/* Do not boot a corrupted image */
+	status = fw_hash_verify(fmac_dev_ctx,
+				fmac_fw,
+				&hash_ctx);
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		goto out;
 	}
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
+
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
 
 	status = nrf_wifi_fmac_fw_boot(fmac_dev_ctx);
+
+	load_stats->boot_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: FW boot failed",
 				      __func__);
@@ -358,7 +579,17 @@ enum nrf_wifi_status nrf_wifi_fmac_fw_load(struct nrf_wifi_fmac_dev_ctx *fmac_de
 
 	fmac_dev_ctx->fw_boot_done = true;
 
+	nrf_wifi_osal_log_dbg("%s: FW load time (us): reset: %d, UMAC load: %d, LMAC load: %d, boot: %d",
+			      __func__,
+			      load_stats->reset_us,
+			      load_stats->umac_load_us,
+			      load_stats->lmac_load_us,
+			      load_stats->boot_us);
+
 out:
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+	((struct nrf_wifi_hal_dev_ctx *)fmac_dev_ctx->hal_dev_ctx)->fw_patch_chunk_callbk_fn = NULL;
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
 	return status;
 }
 
@@ -382,6 +613,273 @@ out:
 	return status;
 }
 
+#ifdef NRF_WIFI_OTP_CACHE
+static unsigned int otp_cache_csum(const struct nrf_wifi_fmac_otp_cache *otp_cache)
+{
+	const unsigned int *word = (const unsigned int *)otp_cache;
+	unsigned int num_words = offsetof(struct nrf_wifi_fmac_otp_cache, csum) / sizeof(*word);
+	unsigned int csum = 0;
+	unsigned int i = 0;
+
+	for (i = 0; i < num_words; i++) {
+		csum = ((csum << 5) | (csum >> 27)) ^ word[i];
+	}
+
+	return csum;
+}
+
+
+static enum nrf_wifi_status otp_cache_verify(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned int uuid[4];
+
+	status = nrf_wifi_hal_otp_uuid_get(fmac_dev_ctx->hal_dev_ctx,
+					   uuid);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Fetching of OTP UUID failed",
+				      __func__);
+		goto out;
+	}
+
+	/* An imported cache from another chip is worthless, read the OTP */
+	if (nrf_wifi_osal_mem_cmp(uuid,
+				  fmac_dev_ctx->otp_cache.uuid,
+				  sizeof(uuid))) {
+		nrf_wifi_osal_log_info("%s: OTP cache is for another chip, discarding",
+				       __func__);
+		fmac_dev_ctx->otp_cache_valid = false;
+	} else {
+		fmac_dev_ctx->otp_cache_verified = true;
+	}
+out:
+	return status;
+}
+
+
+static void otp_cache_fill(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			   struct nrf_wifi_fmac_otp_info *otp_info,
+			   unsigned int ft_prog_ver,
+			   unsigned int package_info)
+{
+	struct nrf_wifi_fmac_otp_cache *otp_cache = &fmac_dev_ctx->otp_cache;
+
+	otp_cache->magic = NRF_WIFI_OTP_CACHE_MAGIC;
+	otp_cache->version = NRF_WIFI_OTP_CACHE_VERSION;
+	otp_cache->flags = otp_info->flags;
+	otp_cache->ft_prog_ver = ft_prog_ver;
+	otp_cache->package_info = package_info;
+
+	nrf_wifi_osal_mem_cpy(otp_cache->uuid,
+			      otp_info->info.info_uuid,
+			      sizeof(otp_cache->uuid));
+	nrf_wifi_osal_mem_cpy(otp_cache->mac_address0,
+			      otp_info->info.mac_address0,
+			      sizeof(otp_cache->mac_address0));
+	nrf_wifi_osal_mem_cpy(otp_cache->mac_address1,
+			      otp_info->info.mac_address1,
+			      sizeof(otp_cache->mac_address1));
+	nrf_wifi_osal_mem_cpy(otp_cache->calib,
+			      otp_info->info.calib,
+			      sizeof(otp_cache->calib));
+
+	otp_cache->csum = otp_cache_csum(otp_cache);
+
+	fmac_dev_ctx->otp_cache_valid = true;
+	fmac_dev_ctx->otp_cache_verified = true;
+}
+
+
+static void otp_cache_apply(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			    struct nrf_wifi_fmac_otp_info *otp_info,
+			    unsigned int *ft_prog_ver,
+			    unsigned int *package_info)
+{
+	struct nrf_wifi_fmac_otp_cache *otp_cache = &fmac_dev_ctx->otp_cache;
+
+	otp_info->flags = otp_cache->flags;
+
+	nrf_wifi_osal_mem_cpy(otp_info->info.info_uuid,
+			      otp_cache->uuid,
+			      sizeof(otp_cache->uuid));
+	nrf_wifi_osal_mem_cpy(otp_info->info.mac_address0,
+			      otp_cache->mac_address0,
+			      sizeof(otp_cache->mac_address0));
+	nrf_wifi_osal_mem_cpy(otp_info->info.mac_address1,
+			      otp_cache->mac_address1,
+			      sizeof(otp_cache->mac_address1));
+	nrf_wifi_osal_mem_cpy(otp_info->info.calib,
+			      otp_cache->calib,
+			      sizeof(otp_cache->calib));
+
+	if (ft_prog_ver) {
+		*ft_prog_ver = otp_cache->ft_prog_ver;
+	}
+
+	if (package_info) {
+		*package_info = otp_cache->package_info;
+	}
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_otp_cache_export(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						    struct nrf_wifi_fmac_otp_cache *otp_cache)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!fmac_dev_ctx || !otp_cache) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (!fmac_dev_ctx->otp_cache_valid) {
+		nrf_wifi_osal_log_err("%s: OTP parameters not read yet",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_cpy(otp_cache,
+			      &fmac_dev_ctx->otp_cache,
+			      sizeof(*otp_cache));
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_otp_cache_import(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						    const struct nrf_wifi_fmac_otp_cache *otp_cache)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!fmac_dev_ctx || !otp_cache) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if ((otp_cache->magic != NRF_WIFI_OTP_CACHE_MAGIC) ||
+	    (otp_cache->version != NRF_WIFI_OTP_CACHE_VERSION) ||
+	    (otp_cache->csum != otp_cache_csum(otp_cache))) {
+		nrf_wifi_osal_log_err("%s: Invalid OTP cache",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_cpy(&fmac_dev_ctx->otp_cache,
+			      otp_cache,
+			      sizeof(fmac_dev_ctx->otp_cache));
+
+	/* Checked against the chip UUID on first use */
+	fmac_dev_ctx->otp_cache_valid = true;
+	fmac_dev_ctx->otp_cache_verified = false;
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_OTP_CACHE */
+
+
+enum nrf_wifi_status nrf_wifi_fmac_otp_params_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						  struct nrf_wifi_fmac_otp_info *otp_info,
+						  unsigned int *ft_prog_ver,
+						  unsigned int *package_info)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+#ifdef NRF_WIFI_OTP_CACHE
+	unsigned int cache_ft_prog_ver = 0;
+	/* If package_info is not written to OTP then the default value will be 0xFF. */
+	unsigned int cache_package_info = 0xFFFFFFFF;
+#endif /* NRF_WIFI_OTP_CACHE */
+
+	if (!fmac_dev_ctx || !otp_info) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_set(otp_info,
+			      0xFF,
+			      sizeof(*otp_info));
+
+#ifdef NRF_WIFI_OTP_CACHE
+	if (fmac_dev_ctx->otp_cache_valid &&
+	    !fmac_dev_ctx->otp_cache_verified) {
+		status = otp_cache_verify(fmac_dev_ctx);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+	}
+
+	if (fmac_dev_ctx->otp_cache_valid) {
+		otp_cache_apply(fmac_dev_ctx,
+				otp_info,
+				ft_prog_ver,
+				package_info);
+		status = NRF_WIFI_STATUS_SUCCESS;
+		goto out;
+	}
+
+	/* Read everything on the first call so that later callers are
+	 * served from the cache.
+	 */
+	if (!ft_prog_ver) {
+		ft_prog_ver = &cache_ft_prog_ver;
+	}
+
+	if (!package_info) {
+		package_info = &cache_package_info;
+	}
+#endif /* NRF_WIFI_OTP_CACHE */
+
+	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
+					   &otp_info->info,
+					   &otp_info->flags);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
+				      __func__);
+		goto out;
+	}
+
+	if (ft_prog_ver) {
+		status = nrf_wifi_hal_otp_ft_prog_ver_get(fmac_dev_ctx->hal_dev_ctx,
+							  ft_prog_ver);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Fetching of FT program version failed",
+					      __func__);
+			goto out;
+		}
+	}
+
+	if (package_info) {
+		status = nrf_wifi_hal_otp_pack_info_get(fmac_dev_ctx->hal_dev_ctx,
+							package_info);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Fetching of Package info failed",
+					      __func__);
+			goto out;
+		}
+	}
+
+#ifdef NRF_WIFI_OTP_CACHE
+	otp_cache_fill(fmac_dev_ctx,
+		       otp_info,
+		       *ft_prog_ver,
+		       *package_info);
+#endif /* NRF_WIFI_OTP_CACHE */
+out:
+	return status;
+}
+
+
 enum nrf_wifi_status nrf_wifi_fmac_otp_mac_addr_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						    unsigned char vif_idx,
 						    unsigned char *mac_addr)
@@ -397,13 +895,10 @@ enum nrf_wifi_status nrf_wifi_fmac_otp_mac_addr_get(struct nrf_wifi_fmac_dev_ctx
 		goto out;
 	}
 
-	nrf_wifi_osal_mem_set(&otp_info,
-			      0xFF,
-			      sizeof(otp_info));
-
-	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
-					   &otp_info.info,
-					   &otp_info.flags);
+	status = nrf_wifi_fmac_otp_params_get(fmac_dev_ctx,
+					      &otp_info,
+					      NULL,
+					      NULL);
 
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
@@ -14,6 +14,9 @@
 #include "host_rpu_umac_if.h"
 #include "common/fmac_structs_common.h"
 #include "common/fmac_util.h"
+#if defined(NRF70_SYSTEM_MODE) && defined(NRF_WIFI_RPU_RECOVERY_REPLAY)
+#include "system/fmac_api.h"
+#endif /* NRF70_SYSTEM_MODE && NRF_WIFI_RPU_RECOVERY_REPLAY */
 
 struct host_rpu_msg *umac_cmd_alloc(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				    int type,
@@ -76,6 +79,14 @@ enum nrf_wifi_status umac_cmd_cfg(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			      __func__,
 			      ((struct nrf_wifi_umac_hdr *)params)->cmd_evnt);
 
+#if defined(NRF70_SYSTEM_MODE) && defined(NRF_WIFI_RPU_RECOVERY_REPLAY)
+	if ((status == NRF_WIFI_STATUS_SUCCESS) &&
+	    (fmac_dev_ctx->op_mode == NRF_WIFI_OP_MODE_SYS)) {
+		nrf_wifi_sys_fmac_recovery_cmd_record(fmac_dev_ctx,
+						      params,
+						      len);
+	}
+#endif /* NRF70_SYSTEM_MODE && NRF_WIFI_RPU_RECOVERY_REPLAY */
 out:
 	return status;
 }
@@ -178,7 +178,6 @@ enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_dev_init(
 		unsigned char *country_code)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-	struct nrf_wifi_fmac_otp_info otp_info;
 	struct nrf_wifi_phy_rf_params phy_rf_params;
 
 	if (!fmac_dev_ctx) {
@@ -205,19 +204,6 @@ enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_dev_init(
 			      tx_pwr_ceil_params,
 			      sizeof(*tx_pwr_ceil_params));
 
-	nrf_wifi_osal_mem_set(&otp_info,
-			      0xFF,
-			      sizeof(otp_info));
-
-	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
-					   &otp_info.info,
-					   &otp_info.flags);
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
-				      __func__);
-		goto out;
-	}
-
 	status = nrf_wifi_off_raw_tx_fmac_rf_params_get(fmac_dev_ctx,
 							&phy_rf_params);
 
@@ -373,6 +359,132 @@ out:
 	return status;
 }
 
+#ifdef NRF_WIFI_OFF_RAW_TX_SCHED
+static enum nrf_wifi_status off_raw_tx_sched_validate(const struct nrf_wifi_off_raw_tx_sched *sched)
+{
+	const struct nrf_wifi_off_raw_tx_sched_entry *entry = NULL;
+	unsigned int next_offset_us = 0;
+	unsigned int i = 0;
+
+	if (!sched->num_entries ||
+	    sched->num_entries > NRF_WIFI_OFF_RAW_TX_SCHED_MAX_ENTRIES) {
+		nrf_wifi_osal_log_err("%s: Invalid number of entries %d",
+				      __func__,
+				      sched->num_entries);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	if (sched->entries[0].offset_us != 0) {
+		nrf_wifi_osal_log_err("%s: First entry must be at offset 0",
+				      __func__);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	for (i = 0; i < sched->num_entries; i++) {
+		entry = &sched->entries[i];
+
+		next_offset_us = (i + 1 < sched->num_entries) ?
+			sched->entries[i + 1].offset_us : sched->period_us;
+
+		if (next_offset_us <= entry->offset_us) {
+			nrf_wifi_osal_log_err("%s: Entry %d is not before the next one",
+					      __func__,
+					      i);
+			return NRF_WIFI_STATUS_FAIL;
+		}
+
+		if (next_offset_us - entry->offset_us < NRF_WIFI_OFF_RAW_TX_SCHED_MIN_GAP_US) {
+			nrf_wifi_osal_log_err("%s: Entry %d is less than %d us before the next one",
+					      __func__,
+					      i,
+					      NRF_WIFI_OFF_RAW_TX_SCHED_MIN_GAP_US);
+			return NRF_WIFI_STATUS_FAIL;
+		}
+
+		if (entry->tx_pwr < NRF_WIFI_OFFLOAD_TX_PWR_MIN ||
+		    entry->tx_pwr > NRF_WIFI_OFFLOAD_TX_PWR_MAX) {
+			nrf_wifi_osal_log_err("%s: Invalid TX power %d for entry %d",
+					      __func__,
+					      entry->tx_pwr,
+					      i);
+			return NRF_WIFI_STATUS_FAIL;
+		}
+
+		if (entry->tx_params.pkt_length < NRF_WIFI_OFFLOAD_PKT_LEN_MIN ||
+		    entry->tx_params.pkt_length > NRF_WIFI_OFFLOAD_PKT_LEN_MAX) {
+			nrf_wifi_osal_log_err("%s: Invalid packet length %d for entry %d",
+					      __func__,
+					      entry->tx_params.pkt_length,
+					      i);
+			return NRF_WIFI_STATUS_FAIL;
+		}
+	}
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_sched_set(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							const struct nrf_wifi_off_raw_tx_sched *sched)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_off_raw_tx_fmac_dev_ctx *dev_ctx_off_raw_tx;
+	unsigned char count = 0;
+
+	if (!fmac_dev_ctx || !sched) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_OFF_RAW_TX) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	status = off_raw_tx_sched_validate(sched);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		goto out;
+	}
+
+	dev_ctx_off_raw_tx = wifi_dev_priv(fmac_dev_ctx);
+	dev_ctx_off_raw_tx->off_raw_tx_cmd_done = true;
+
+	status = umac_cmd_off_raw_tx_sched(fmac_dev_ctx,
+					   sched);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: umac_cmd_off_raw_tx_sched failed", __func__);
+		goto out;
+	}
+
+	do {
+		nrf_wifi_osal_sleep_ms(1);
+		count++;
+	} while ((dev_ctx_off_raw_tx->off_raw_tx_cmd_done == true) &&
+		 (count < NRF_WIFI_FMAC_PARAMS_RECV_TIMEOUT));
+
+	if (count == NRF_WIFI_FMAC_PARAMS_RECV_TIMEOUT) {
+		nrf_wifi_osal_log_err("%s: Timed out",
+				      __func__);
+		status = NRF_WIFI_STATUS_FAIL;
+		goto out;
+	}
+
+	if (dev_ctx_off_raw_tx->off_raw_tx_cmd_status != NRF_WIFI_UMAC_CMD_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Schedule rejected by the RPU (%d)",
+				      __func__,
+				      dev_ctx_off_raw_tx->off_raw_tx_cmd_status);
+		status = NRF_WIFI_STATUS_FAIL;
+		goto out;
+	}
+out:
+	return status;
+}
+#endif /* NRF_WIFI_OFF_RAW_TX_SCHED */
+
 
 enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 							enum rpu_op_mode op_mode,
@@ -557,32 +669,13 @@ enum nrf_wifi_status nrf_wifi_off_raw_tx_fmac_rf_params_get(struct nrf_wifi_fmac
 
 	tx_pwr_ceil_params = fmac_dev_ctx->tx_pwr_ceil_params;
 
-	nrf_wifi_osal_mem_set(&otp_info,
-			      0xFF,
-			      sizeof(otp_info));
-
-	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
-					   &otp_info.info,
-					   &otp_info.flags);
-
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
-				      __func__);
-		goto out;
-	}
-
-	status = nrf_wifi_hal_otp_ft_prog_ver_get(fmac_dev_ctx->hal_dev_ctx,
-						  &ft_prog_ver);
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of FT program version failed",
-				      __func__);
-		goto out;
-	}
+	status = nrf_wifi_fmac_otp_params_get(fmac_dev_ctx,
+					      &otp_info,
+					      &ft_prog_ver,
+					      &package_info);
 
-	status = nrf_wifi_hal_otp_pack_info_get(fmac_dev_ctx->hal_dev_ctx,
-						&package_info);
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of Package info failed",
+		nrf_wifi_osal_log_err("%s: Fetching of OTP parameters failed",
 				      __func__);
 		goto out;
 	}
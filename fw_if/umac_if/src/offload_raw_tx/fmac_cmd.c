@@ -232,6 +232,62 @@ out:
 	return status;
 }
 
+#ifdef NRF_WIFI_OFF_RAW_TX_SCHED
+enum nrf_wifi_status umac_cmd_off_raw_tx_sched(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					       const struct nrf_wifi_off_raw_tx_sched *sched)
+{
+	struct host_rpu_msg *umac_cmd = NULL;
+	struct nrf_wifi_cmd_offload_raw_tx_sched *umac_cmd_data = NULL;
+	struct nrf_wifi_offload_sched_entry *cmd_entry = NULL;
+	const struct nrf_wifi_off_raw_tx_sched_entry *entry = NULL;
+	unsigned int i = 0;
+	int len = 0;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!fmac_dev_ctx->fw_init_done) {
+		nrf_wifi_osal_log_err("%s: UMAC buff config not yet done", __func__);
+		goto out;
+	}
+
+	len = sizeof(*umac_cmd_data);
+
+	umac_cmd = umac_cmd_alloc(fmac_dev_ctx,
+				  NRF_WIFI_HOST_RPU_MSG_TYPE_SYSTEM,
+				  len);
+
+	if (!umac_cmd) {
+		nrf_wifi_osal_log_err("%s: umac_cmd_alloc failed", __func__);
+		goto out;
+	}
+
+	umac_cmd_data = (struct nrf_wifi_cmd_offload_raw_tx_sched *)(umac_cmd->msg);
+
+	umac_cmd_data->sys_head.cmd_event = NRF_WIFI_CMD_OFFLOAD_RAW_TX_SCHED;
+	umac_cmd_data->sys_head.len = len;
+	umac_cmd_data->period_in_us = sched->period_us;
+	umac_cmd_data->num_entries = sched->num_entries;
+
+	for (i = 0; i < sched->num_entries; i++) {
+		entry = &sched->entries[i];
+		cmd_entry = &umac_cmd_data->entries[i];
+
+		cmd_entry->offset_in_us = entry->offset_us;
+		cmd_entry->tx_pwr = entry->tx_pwr;
+		cmd_entry->channel_no = entry->channel_no;
+
+		nrf_wifi_osal_mem_cpy(&cmd_entry->tx_params,
+				      &entry->tx_params,
+				      sizeof(cmd_entry->tx_params));
+	}
+
+	status = nrf_wifi_hal_ctrl_cmd_send(fmac_dev_ctx->hal_dev_ctx,
+					    umac_cmd,
+					    (sizeof(*umac_cmd) + len));
+out:
+	return status;
+}
+#endif /* NRF_WIFI_OFF_RAW_TX_SCHED */
+
 enum nrf_wifi_status umac_cmd_off_raw_tx_ctrl(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 					      unsigned char ctrl_type)
 {
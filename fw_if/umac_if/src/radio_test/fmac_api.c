@@ -14,6 +14,7 @@
 #include "radio_test/hal_api.h"
 #include "radio_test/fmac_structs.h"
 #include "common/fmac_util.h"
+#include "common/hal_mem.h"
 #include "radio_test/fmac_cmd.h"
 #include "radio_test/fmac_event.h"
 #include "util.h"
@@ -147,7 +148,6 @@ enum nrf_wifi_status nrf_wifi_rt_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fma
 					       unsigned char *country_code)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-	struct nrf_wifi_fmac_otp_info otp_info;
 	struct nrf_wifi_phy_rf_params phy_rf_params;
 
 	if (!fmac_dev_ctx) {
@@ -175,20 +175,6 @@ enum nrf_wifi_status nrf_wifi_rt_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fma
 			      tx_pwr_ceil_params,
 			      sizeof(*tx_pwr_ceil_params));
 
-	nrf_wifi_osal_mem_set(&otp_info,
-			      0xFF,
-			      sizeof(otp_info));
-
-	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
-					   &otp_info.info,
-					   &otp_info.flags);
-
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
-				      __func__);
-		goto out;
-	}
-
 	status = nrf_wifi_rt_fmac_rf_params_get(fmac_dev_ctx,
 						&phy_rf_params);
 
@@ -444,25 +430,20 @@ out:
 }
 
 
-enum nrf_wifi_status nrf_wifi_rt_fmac_rf_test_rx_cap(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
-						     enum nrf_wifi_rf_test rf_test_type,
-						     void *cap_data,
-						     unsigned short int num_samples,
-						     unsigned short int capture_timeout ,
-						     unsigned char lna_gain,
-						     unsigned char bb_gain,
-						     unsigned char *capture_status)
+static enum nrf_wifi_status rf_test_rx_cap_run(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					       enum nrf_wifi_rf_test rf_test_type,
+					       void *cap_data,
+					       unsigned short int num_samples,
+					       unsigned short int capture_timeout,
+					       unsigned char lna_gain,
+					       unsigned char bb_gain,
+					       unsigned char *capture_status)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct nrf_wifi_rf_test_capture_params rf_test_cap_params;
 	struct nrf_wifi_rt_fmac_dev_ctx *rt_dev_ctx = NULL;
-	unsigned int count = 0;
-
-	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_RT) {
-		nrf_wifi_osal_log_err("%s: Invalid op mode",
-				      __func__);
-		goto out;
-	}
+	unsigned long start_time_ms = 0;
+	unsigned long timeout_ms = 0;
 
 	rt_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
@@ -478,7 +459,7 @@ enum nrf_wifi_status nrf_wifi_rt_fmac_rf_test_rx_cap(struct nrf_wifi_fmac_dev_ct
 
 	rt_dev_ctx->rf_test_type = rf_test_type;
 	rt_dev_ctx->rf_test_cap_data = cap_data;
-	rt_dev_ctx->rf_test_cap_sz = (num_samples * 3);
+	rt_dev_ctx->rf_test_cap_sz = (num_samples * RF_TEST_CAP_SAMPLE_SZ);
 	rt_dev_ctx->capture_status = 0;
 
 	status = umac_cmd_rt_prog_rf_test(fmac_dev_ctx,
@@ -492,23 +473,175 @@ enum nrf_wifi_status nrf_wifi_rt_fmac_rf_test_rx_cap(struct nrf_wifi_fmac_dev_ct
 		goto out;
 	}
 
-	do {
-		nrf_wifi_osal_sleep_ms(100);
-		count++;
-	} while ((rt_dev_ctx->rf_test_type != NRF_WIFI_RF_TEST_MAX) &&
-		 (count < (RX_CAPTURE_TIMEOUT_CONST * capture_timeout)));
+	/* The RF test event marks the completion by resetting the test type,
+	 * poll for it with a fine granularity against a deadline so that the
+	 * capture is picked up as soon as it is done.
+	 */
+	timeout_ms = RX_CAPTURE_TIMEOUT_CONST * capture_timeout * 100;
+	start_time_ms = nrf_wifi_osal_time_get_curr_ms();
+
+	while (rt_dev_ctx->rf_test_type != NRF_WIFI_RF_TEST_MAX) {
+		if (nrf_wifi_osal_time_elapsed_ms(start_time_ms) >= timeout_ms) {
+			nrf_wifi_osal_log_err("%s: Timed out",
+					      __func__);
+			rt_dev_ctx->rf_test_type = NRF_WIFI_RF_TEST_MAX;
+			rt_dev_ctx->rf_test_cap_data = NULL;
+			status = NRF_WIFI_STATUS_FAIL;
+			goto out;
+		}
 
-	if (count == (RX_CAPTURE_TIMEOUT_CONST * capture_timeout)) {
-		nrf_wifi_osal_log_err("%s: Timed out",
+		nrf_wifi_osal_sleep_ms(1);
+	}
+
+	rt_dev_ctx->rf_test_cap_data = NULL;
+	*capture_status = rt_dev_ctx->capture_status;
+
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_rt_fmac_rf_test_rx_cap(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						     enum nrf_wifi_rf_test rf_test_type,
+						     void *cap_data,
+						     unsigned short int num_samples,
+						     unsigned short int capture_timeout,
+						     unsigned char lna_gain,
+						     unsigned char bb_gain,
+						     unsigned char *capture_status)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_RT) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
 				      __func__);
-		rt_dev_ctx->rf_test_type = NRF_WIFI_RF_TEST_MAX;
-		rt_dev_ctx->rf_test_cap_data = NULL;
-		status = NRF_WIFI_STATUS_FAIL;
 		goto out;
 	}
-	*capture_status = rt_dev_ctx->capture_status;
 
+	if (!cap_data) {
+		nrf_wifi_osal_log_err("%s: Invalid params",
+				      __func__);
+		goto out;
+	}
+
+	status = rf_test_rx_cap_run(fmac_dev_ctx,
+				    rf_test_type,
+				    cap_data,
+				    num_samples,
+				    capture_timeout,
+				    lna_gain,
+				    bb_gain,
+				    capture_status);
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_rt_fmac_rf_test_rx_cap_stream(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							    enum nrf_wifi_rf_test rf_test_type,
+							    unsigned short int num_samples,
+							    unsigned short int chunk_samples,
+							    unsigned short int capture_timeout,
+							    unsigned char lna_gain,
+							    unsigned char bb_gain,
+							    unsigned char *capture_status,
+							    enum nrf_wifi_status (*cap_chunk_callbk_fn)(void *callbk_data,
+													 void *chunk,
+													 unsigned int chunk_len,
+													 unsigned int offset),
+							    void *callbk_data)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned char *chunk_bufs = NULL;
+	unsigned char *chunk = NULL;
+	unsigned int chunk_sz = 0;
+	unsigned int cap_sz = 0;
+	unsigned int offset = 0;
+	unsigned int len = 0;
+	unsigned int buf_idx = 0;
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_RT) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	/* Keep the chunks word aligned in the RPU memory and sample aligned
+	 * for the consumer.
+	 */
+	if (!cap_chunk_callbk_fn || !chunk_samples ||
+	    (chunk_samples % RF_TEST_CAP_CHUNK_ALIGN_SAMPLES)) {
+		nrf_wifi_osal_log_err("%s: Invalid params",
+				      __func__);
+		goto out;
+	}
+
+	chunk_sz = chunk_samples * RF_TEST_CAP_SAMPLE_SZ;
+	cap_sz = num_samples * RF_TEST_CAP_SAMPLE_SZ;
+
+	chunk_bufs = nrf_wifi_osal_mem_alloc(2 * chunk_sz);
+
+	if (!chunk_bufs) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate chunk buffers",
+				      __func__);
+		goto out;
+	}
+
+	/* The capture stays in the RPU memory, it is read out below */
+	status = rf_test_rx_cap_run(fmac_dev_ctx,
+				    rf_test_type,
+				    NULL,
+				    num_samples,
+				    capture_timeout,
+				    lna_gain,
+				    bb_gain,
+				    capture_status);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		goto out;
+	}
+
+	/* Alternate between two chunk buffers so that the consumer can keep
+	 * working on (e.g. transmitting) the previous chunk while the next one
+	 * is being read from the RPU.
+	 */
+	for (offset = 0; offset < cap_sz; offset += len) {
+		len = cap_sz - offset;
+
+		if (len > chunk_sz) {
+			len = chunk_sz;
+		}
+
+		chunk = chunk_bufs + (buf_idx * chunk_sz);
+
+		status = hal_rpu_mem_read(fmac_dev_ctx->hal_dev_ctx,
+					  chunk,
+					  RPU_MEM_RF_TEST_CAP_BASE + offset,
+					  len);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: Reading capture at offset %d failed",
+					      __func__,
+					      offset);
+			goto out;
+		}
+
+		status = cap_chunk_callbk_fn(callbk_data,
+					     chunk,
+					     len,
+					     offset);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+
+		buf_idx ^= 1;
+	}
 out:
+	if (chunk_bufs) {
+		nrf_wifi_osal_mem_free(chunk_bufs);
+	}
+
 	return status;
 }
 
@@ -1093,32 +1226,13 @@ enum nrf_wifi_status nrf_wifi_rt_fmac_rf_params_get(struct nrf_wifi_fmac_dev_ctx
 
 	tx_pwr_ceil_params = fmac_dev_ctx->tx_pwr_ceil_params;
 
-	nrf_wifi_osal_mem_set(&otp_info,
-			      0xFF,
-			      sizeof(otp_info));
-
-	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
-					   &otp_info.info,
-					   &otp_info.flags);
-
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
-				      __func__);
-		goto out;
-	}
-
-	status = nrf_wifi_hal_otp_ft_prog_ver_get(fmac_dev_ctx->hal_dev_ctx,
-						  &ft_prog_ver);
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of FT program version failed",
-				      __func__);
-		goto out;
-	}
+	status = nrf_wifi_fmac_otp_params_get(fmac_dev_ctx,
+					      &otp_info,
+					      &ft_prog_ver,
+					      &package_info);
 
-	status = nrf_wifi_hal_otp_pack_info_get(fmac_dev_ctx->hal_dev_ctx,
-						&package_info);
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of Package info failed",
+		nrf_wifi_osal_log_err("%s: Fetching of OTP parameters failed",
 				      __func__);
 		goto out;
 	}
@@ -86,10 +86,13 @@ static enum nrf_wifi_status umac_event_rt_rf_test_process(struct nrf_wifi_fmac_d
 	case NRF_WIFI_RF_TEST_EVENT_RX_ADC_CAP:
 	case NRF_WIFI_RF_TEST_EVENT_RX_STAT_PKT_CAP:
 	case NRF_WIFI_RF_TEST_EVENT_RX_DYN_PKT_CAP:
-		status = hal_rpu_mem_read(fmac_dev_ctx->hal_dev_ctx,
-					  def_dev_ctx->rf_test_cap_data,
-					  RPU_MEM_RF_TEST_CAP_BASE,
-					  def_dev_ctx->rf_test_cap_sz);
+		/* Streaming captures are read out in chunks by the caller */
+		if (def_dev_ctx->rf_test_cap_data) {
+			status = hal_rpu_mem_read(fmac_dev_ctx->hal_dev_ctx,
+						  def_dev_ctx->rf_test_cap_data,
+						  RPU_MEM_RF_TEST_CAP_BASE,
+						  def_dev_ctx->rf_test_cap_sz);
+		}
 
 		nrf_wifi_osal_mem_cpy(&rf_test_capture_params,
 				      (const unsigned char *)&rf_test_event->rf_test_info.rfevent[0],
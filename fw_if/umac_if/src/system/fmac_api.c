@@ -22,7 +22,15 @@
 #include "system/fmac_cmd.h"
 #include "system/fmac_event.h"
 #include "system/fmac_bb.h"
+#ifdef NRF_WIFI_BSS_CACHE
+#include "system/fmac_bss_cache.h"
+#endif /* NRF_WIFI_BSS_CACHE */
+#ifdef NRF_WIFI_SNIFFER_FILTER
+#include "system/fmac_sniffer_filter.h"
+#endif /* NRF_WIFI_SNIFFER_FILTER */
 #include "util.h"
+#include "queue.h"
+#include "list.h"
 
 
 static unsigned char nrf_wifi_fmac_vif_idx_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
@@ -412,11 +420,86 @@ struct nrf_wifi_fmac_dev_ctx *nrf_wifi_sys_fmac_dev_add(struct nrf_wifi_fmac_pri
 #endif /* NRF70_DATA_TX */
 
 	fmac_dev_ctx->op_mode = NRF_WIFI_OP_MODE_SYS;
+
+#ifdef NRF_WIFI_RPU_RECOVERY_REPLAY
+	sys_fmac_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	sys_fmac_dev_ctx->recovery_cmd_lock = nrf_wifi_osal_spinlock_alloc();
+
+	if (sys_fmac_dev_ctx->recovery_cmd_lock) {
+		nrf_wifi_osal_spinlock_init(sys_fmac_dev_ctx->recovery_cmd_lock);
+
+		sys_fmac_dev_ctx->recovery_cmd_list = nrf_wifi_utils_list_alloc();
+	}
+
+	if (!sys_fmac_dev_ctx->recovery_cmd_list) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate recovery command list, replay disabled",
+				      __func__);
+	}
+#endif /* NRF_WIFI_RPU_RECOVERY_REPLAY */
+#ifdef NRF_WIFI_BSS_CACHE
+	if (nrf_wifi_fmac_bss_cache_init(fmac_dev_ctx) != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Unable to initialize BSS cache, cache disabled",
+				      __func__);
+	}
+#endif /* NRF_WIFI_BSS_CACHE */
 out:
 	return fmac_dev_ctx;
 }
 
 
+#ifdef NRF_WIFI_RPU_RECOVERY_REPLAY
+static void recovery_init_params_save(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+#ifdef NRF_WIFI_LOW_POWER
+				      int sleep_type,
+#endif /* NRF_WIFI_LOW_POWER */
+				      unsigned int phy_calib,
+				      enum op_band op_band,
+				      bool beamforming,
+				      struct nrf_wifi_tx_pwr_ctrl_params *tx_pwr_ctrl_params,
+				      struct nrf_wifi_tx_pwr_ceil_params *tx_pwr_ceil_params,
+				      struct nrf_wifi_board_params *board_params,
+				      unsigned char *country_code)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_recovery_init_params *init_params = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	init_params = &sys_dev_ctx->recovery_init_params;
+
+	/* A warm recovery re-uses the saved parameters */
+	if (sys_dev_ctx->recovery_replay_active) {
+		return;
+	}
+
+#ifdef NRF_WIFI_LOW_POWER
+	init_params->sleep_type = sleep_type;
+#endif /* NRF_WIFI_LOW_POWER */
+	init_params->phy_calib = phy_calib;
+	init_params->op_band = op_band;
+	init_params->beamforming = beamforming;
+
+	nrf_wifi_osal_mem_cpy(&init_params->tx_pwr_ctrl_params,
+			      tx_pwr_ctrl_params,
+			      sizeof(init_params->tx_pwr_ctrl_params));
+
+	nrf_wifi_osal_mem_cpy(&init_params->tx_pwr_ceil_params,
+			      tx_pwr_ceil_params,
+			      sizeof(init_params->tx_pwr_ceil_params));
+
+	nrf_wifi_osal_mem_cpy(&init_params->board_params,
+			      board_params,
+			      sizeof(init_params->board_params));
+
+	nrf_wifi_osal_mem_cpy(init_params->country_code,
+			      country_code,
+			      sizeof(init_params->country_code));
+
+	init_params->valid = true;
+}
+#endif /* NRF_WIFI_RPU_RECOVERY_REPLAY */
+
+
 enum nrf_wifi_status nrf_wifi_sys_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 #ifdef NRF_WIFI_LOW_POWER
 					    int sleep_type,
@@ -430,7 +513,6 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fm
 					    unsigned char *country_code)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-		struct nrf_wifi_fmac_otp_info otp_info;
 	struct nrf_wifi_phy_rf_params phy_rf_params;
 
 	if (!fmac_dev_ctx) {
@@ -457,20 +539,6 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fm
 		goto out;
 	}
 
-	nrf_wifi_osal_mem_set(&otp_info,
-			      0xFF,
-			      sizeof(otp_info));
-
-	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
-					   &otp_info.info,
-					   &otp_info.flags);
-
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
-				      __func__);
-		goto out;
-	}
-
 	status = nrf_wifi_sys_fmac_rf_params_get(fmac_dev_ctx,
 						 &phy_rf_params);
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
@@ -497,6 +565,20 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_dev_init(struct nrf_wifi_fmac_dev_ctx *fm
 				      __func__);
 		goto out;
 	}
+
+#ifdef NRF_WIFI_RPU_RECOVERY_REPLAY
+	recovery_init_params_save(fmac_dev_ctx,
+#ifdef NRF_WIFI_LOW_POWER
+				  sleep_type,
+#endif /* NRF_WIFI_LOW_POWER */
+				  phy_calib,
+				  op_band,
+				  beamforming,
+				  tx_pwr_ctrl_params,
+				  tx_pwr_ceil_params,
+				  board_params,
+				  country_code);
+#endif /* NRF_WIFI_RPU_RECOVERY_REPLAY */
 out:
 	return status;
 }
@@ -582,6 +664,412 @@ out:
 }
 #endif /* NRF_WIFI_RPU_RECOVERY */
 
+#ifdef NRF_WIFI_RPU_RECOVERY_REPLAY
+struct recovery_cmd_info {
+	unsigned int cmd;
+	unsigned int wdev_id;
+	int len;
+	unsigned char data[];
+};
+
+struct recovery_cmd_match {
+	unsigned int cmd;
+	unsigned int wdev_id;
+	/* Match any command of the interface */
+	bool any_cmd;
+	struct recovery_cmd_info *found;
+};
+
+
+/* Configuration which the RPU loses on a reset and which can be restored
+ * without any peer being involved. Only the latest command of each kind per
+ * interface is kept.
+ */
+static bool recovery_cmd_is_replayable(unsigned int cmd)
+{
+	switch (cmd) {
+	case NRF_WIFI_UMAC_CMD_NEW_INTERFACE:
+	case NRF_WIFI_UMAC_CMD_SET_INTERFACE:
+	case NRF_WIFI_UMAC_CMD_SET_IFFLAGS:
+	case NRF_WIFI_UMAC_CMD_CHANGE_MACADDR:
+	case NRF_WIFI_UMAC_CMD_SET_WIPHY:
+	case NRF_WIFI_UMAC_CMD_SET_QOS_MAP:
+	case NRF_WIFI_UMAC_CMD_SET_POWER_SAVE:
+	case NRF_WIFI_UMAC_CMD_SET_POWER_SAVE_TIMEOUT:
+	case NRF_WIFI_UMAC_CMD_SET_LISTEN_INTERVAL:
+	case NRF_WIFI_UMAC_CMD_CONFIG_UAPSD:
+	case NRF_WIFI_UMAC_CMD_CONFIG_EXTENDED_PS:
+	case NRF_WIFI_UMAC_CMD_PS_EXIT_STRATEGY:
+	case NRF_WIFI_UMAC_CMD_START_AP:
+	case NRF_WIFI_UMAC_CMD_SET_BSS:
+	case NRF_WIFI_UMAC_CMD_SET_BEACON:
+		return true;
+	default:
+		return false;
+	}
+}
+
+
+static enum nrf_wifi_status recovery_cmd_match_callbk_fn(void *callbk_data,
+							 void *data)
+{
+	struct recovery_cmd_match *match = callbk_data;
+	struct recovery_cmd_info *cmd_info = data;
+
+	if ((cmd_info->wdev_id == match->wdev_id) &&
+	    (match->any_cmd || (cmd_info->cmd == match->cmd))) {
+		match->found = cmd_info;
+
+		/* Stop the traversal */
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+static struct recovery_cmd_info *recovery_cmd_find(void *list,
+						   unsigned int cmd,
+						   unsigned int wdev_id,
+						   bool any_cmd)
+{
+	struct recovery_cmd_match match;
+
+	nrf_wifi_osal_mem_set(&match,
+			      0,
+			      sizeof(match));
+
+	match.cmd = cmd;
+	match.wdev_id = wdev_id;
+	match.any_cmd = any_cmd;
+
+	nrf_wifi_utils_list_traverse(list,
+				     &match,
+				     recovery_cmd_match_callbk_fn);
+
+	return match.found;
+}
+
+
+static void recovery_cmds_del(struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx,
+			      unsigned int cmd,
+			      unsigned int wdev_id,
+			      bool any_cmd)
+{
+	struct recovery_cmd_info *cmd_info = NULL;
+
+	while (1) {
+		nrf_wifi_osal_spinlock_take(sys_dev_ctx->recovery_cmd_lock);
+
+		cmd_info = recovery_cmd_find(sys_dev_ctx->recovery_cmd_list,
+					     cmd,
+					     wdev_id,
+					     any_cmd);
+
+		if (cmd_info) {
+			nrf_wifi_utils_list_del_node(sys_dev_ctx->recovery_cmd_list,
+						     cmd_info);
+		}
+
+		nrf_wifi_osal_spinlock_rel(sys_dev_ctx->recovery_cmd_lock);
+
+		if (!cmd_info) {
+			break;
+		}
+
+		nrf_wifi_osal_mem_free(cmd_info);
+	}
+}
+
+
+void nrf_wifi_sys_fmac_recovery_cmd_record(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					   const void *params,
+					   int len)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	const struct nrf_wifi_umac_hdr *umac_hdr = params;
+	struct recovery_cmd_info *cmd_info = NULL;
+	struct recovery_cmd_info *old_cmd_info = NULL;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (!sys_dev_ctx->recovery_cmd_list ||
+	    sys_dev_ctx->recovery_replay_active) {
+		return;
+	}
+
+	switch (umac_hdr->cmd_evnt) {
+	case NRF_WIFI_UMAC_CMD_DEL_INTERFACE:
+		recovery_cmds_del(sys_dev_ctx,
+				  0,
+				  umac_hdr->ids.wdev_id,
+				  true);
+		return;
+	case NRF_WIFI_UMAC_CMD_STOP_AP:
+		recovery_cmds_del(sys_dev_ctx,
+				  NRF_WIFI_UMAC_CMD_START_AP,
+				  umac_hdr->ids.wdev_id,
+				  false);
+		recovery_cmds_del(sys_dev_ctx,
+				  NRF_WIFI_UMAC_CMD_SET_BSS,
+				  umac_hdr->ids.wdev_id,
+				  false);
+		recovery_cmds_del(sys_dev_ctx,
+				  NRF_WIFI_UMAC_CMD_SET_BEACON,
+				  umac_hdr->ids.wdev_id,
+				  false);
+		return;
+	default:
+		break;
+	}
+
+	if (!recovery_cmd_is_replayable(umac_hdr->cmd_evnt)) {
+		return;
+	}
+
+	cmd_info = nrf_wifi_osal_mem_alloc(sizeof(*cmd_info) + len);
+
+	if (!cmd_info) {
+		nrf_wifi_osal_log_err("%s: Unable to record command %d",
+				      __func__,
+				      umac_hdr->cmd_evnt);
+		return;
+	}
+
+	cmd_info->cmd = umac_hdr->cmd_evnt;
+	cmd_info->wdev_id = umac_hdr->ids.wdev_id;
+	cmd_info->len = len;
+
+	nrf_wifi_osal_mem_cpy(cmd_info->data,
+			      params,
+			      len);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->recovery_cmd_lock);
+
+	/* Keep the position of the first command of its kind, so that the
+	 * replay order honours the dependencies between the commands.
+	 */
+	old_cmd_info = recovery_cmd_find(sys_dev_ctx->recovery_cmd_list,
+					 cmd_info->cmd,
+					 cmd_info->wdev_id,
+					 false);
+
+	if (old_cmd_info) {
+		status = nrf_wifi_utils_list_replace_node(sys_dev_ctx->recovery_cmd_list,
+							  old_cmd_info,
+							  cmd_info);
+	} else {
+		status = nrf_wifi_utils_list_add_tail(sys_dev_ctx->recovery_cmd_list,
+						      cmd_info);
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->recovery_cmd_lock);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Unable to record command %d",
+				      __func__,
+				      cmd_info->cmd);
+		nrf_wifi_osal_mem_free(cmd_info);
+		return;
+	}
+
+	if (old_cmd_info) {
+		nrf_wifi_osal_mem_free(old_cmd_info);
+	}
+}
+
+
+static enum nrf_wifi_status recovery_cmd_replay_callbk_fn(void *callbk_data,
+							  void *data)
+{
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = callbk_data;
+	struct recovery_cmd_info *cmd_info = data;
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	status = umac_cmd_cfg(fmac_dev_ctx,
+			      cmd_info->data,
+			      cmd_info->len);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Replay of command %d for wdev %d failed",
+				      __func__,
+				      cmd_info->cmd,
+				      cmd_info->wdev_id);
+	}
+
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_rpu_recovery_replay(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	unsigned int num_cmds = 0;
+
+	if (!fmac_dev_ctx) {
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	if (!fmac_dev_ctx->fw_init_done) {
+		nrf_wifi_osal_log_err("%s: FW not initialized",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (!sys_dev_ctx->recovery_cmd_list) {
+		goto out;
+	}
+
+	num_cmds = nrf_wifi_utils_list_len(sys_dev_ctx->recovery_cmd_list);
+
+	if (!num_cmds) {
+		status = NRF_WIFI_STATUS_SUCCESS;
+		goto out;
+	}
+
+	sys_dev_ctx->recovery_replay_active = true;
+
+	status = nrf_wifi_utils_list_traverse(sys_dev_ctx->recovery_cmd_list,
+					      fmac_dev_ctx,
+					      recovery_cmd_replay_callbk_fn);
+
+	sys_dev_ctx->recovery_replay_active = false;
+
+	nrf_wifi_osal_log_dbg("%s: Replayed %d commands, status: %d",
+			      __func__,
+			      num_cmds,
+			      status);
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_rpu_recovery_warm(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+							 struct nrf_wifi_fmac_fw_info *fmac_fw)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_recovery_init_params *init_params = NULL;
+#ifdef NRF70_DATA_TX
+	unsigned char if_idx = 0;
+#endif /* NRF70_DATA_TX */
+
+	if (!fmac_dev_ctx || !fmac_fw) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	init_params = &sys_dev_ctx->recovery_init_params;
+
+	if (!init_params->valid) {
+		nrf_wifi_osal_log_err("%s: Device was never initialized",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_sys_fmac_dev_deinit(fmac_dev_ctx);
+
+	/* The UMAC init done event of the new firmware is waited for */
+	fmac_dev_ctx->fw_init_done = false;
+
+	status = nrf_wifi_fmac_fw_load(fmac_dev_ctx,
+				       fmac_fw);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: FW load failed",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx->recovery_replay_active = true;
+
+	status = nrf_wifi_sys_fmac_dev_init(fmac_dev_ctx,
+#ifdef NRF_WIFI_LOW_POWER
+					    init_params->sleep_type,
+#endif /* NRF_WIFI_LOW_POWER */
+					    init_params->phy_calib,
+					    init_params->op_band,
+					    init_params->beamforming,
+					    &init_params->tx_pwr_ctrl_params,
+					    &init_params->tx_pwr_ceil_params,
+					    &init_params->board_params,
+					    init_params->country_code);
+
+	sys_dev_ctx->recovery_replay_active = false;
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Device init failed",
+				      __func__);
+		goto out;
+	}
+
+	status = nrf_wifi_sys_fmac_rpu_recovery_replay(fmac_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Configuration replay failed",
+				      __func__);
+		goto out;
+	}
+
+#ifdef NRF70_DATA_TX
+	/* The frames which stopped the queues were freed with the old firmware */
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	for (if_idx = 0; if_idx < MAX_NUM_VIFS; if_idx++) {
+		tx_flow_ctrl_vif_reset(fmac_dev_ctx, if_idx);
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#endif /* NRF70_DATA_TX */
+
+	nrf_wifi_osal_log_info("%s: RPU recovered",
+			       __func__);
+out:
+	return status;
+}
+
+
+void nrf_wifi_sys_fmac_recovery_cmds_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	void *cmd_info = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (sys_dev_ctx->recovery_cmd_list) {
+		while ((cmd_info = nrf_wifi_utils_list_del_head(sys_dev_ctx->recovery_cmd_list))) {
+			nrf_wifi_osal_mem_free(cmd_info);
+		}
+
+		nrf_wifi_utils_list_free(sys_dev_ctx->recovery_cmd_list);
+		sys_dev_ctx->recovery_cmd_list = NULL;
+	}
+
+	if (sys_dev_ctx->recovery_cmd_lock) {
+		nrf_wifi_osal_spinlock_free(sys_dev_ctx->recovery_cmd_lock);
+		sys_dev_ctx->recovery_cmd_lock = NULL;
+	}
+}
+#endif /* NRF_WIFI_RPU_RECOVERY_REPLAY */
+
 struct nrf_wifi_fmac_priv *nrf_wifi_sys_fmac_init(struct nrf_wifi_data_config_params *data_config,
 						  struct rx_buf_pool_params *rx_buf_pools,
 						  struct nrf_wifi_fmac_callbk_fns *callbk_fns)
@@ -1165,140 +1653,562 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_add_key(void *dev_ctx,
 	key_cmd->key_info.valid_fields |= NRF_WIFI_CIPHER_SUITE_VALID;
 	key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_TYPE_VALID;
 
-	status = umac_cmd_cfg(fmac_dev_ctx,
-			      key_cmd,
-			      sizeof(*key_cmd));
+	status = umac_cmd_cfg(fmac_dev_ctx,
+			      key_cmd,
+			      sizeof(*key_cmd));
+
+out:
+	if (key_cmd) {
+		nrf_wifi_osal_mem_free(key_cmd);
+	}
+
+	return status;
+}
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_del_key(void *dev_ctx,
+					       unsigned char if_idx,
+					       struct nrf_wifi_umac_key_info *key_info,
+					       const char *mac_addr)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_umac_cmd_key *key_cmd = NULL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	key_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*key_cmd));
+
+	if (!key_cmd) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate memory",
+				      __func__);
+		goto out;
+	}
+
+	key_cmd->umac_hdr.cmd_evnt = NRF_WIFI_UMAC_CMD_DEL_KEY;
+	key_cmd->umac_hdr.ids.wdev_id = if_idx;
+	key_cmd->umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+
+	nrf_wifi_osal_mem_cpy(&key_cmd->key_info,
+			      key_info,
+			      sizeof(key_cmd->key_info));
+
+	if (mac_addr) {
+		nrf_wifi_osal_mem_cpy(key_cmd->mac_addr,
+				      mac_addr,
+				      NRF_WIFI_ETH_ADDR_LEN);
+
+		key_cmd->valid_fields |= NRF_WIFI_CMD_KEY_MAC_ADDR_VALID;
+	}
+
+	key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_IDX_VALID;
+	key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_TYPE_VALID;
+
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+
+	if (key_info->key_type == NRF_WIFI_KEYTYPE_GROUP) {
+		vif_ctx->groupwise_cipher = 0;
+	}
+
+	status = umac_cmd_cfg(fmac_dev_ctx,
+			      key_cmd,
+			      sizeof(*key_cmd));
+
+out:
+	if (key_cmd) {
+		nrf_wifi_osal_mem_free(key_cmd);
+	}
+
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_set_key(void *dev_ctx,
+					       unsigned char if_idx,
+					       struct nrf_wifi_umac_key_info *key_info)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_umac_cmd_set_key *set_key_cmd = NULL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	set_key_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*set_key_cmd));
+
+	if (!set_key_cmd) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate memory",
+				      __func__);
+		goto out;
+	}
+
+	set_key_cmd->umac_hdr.cmd_evnt = NRF_WIFI_UMAC_CMD_SET_KEY;
+	set_key_cmd->umac_hdr.ids.wdev_id = if_idx;
+	set_key_cmd->umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+
+	nrf_wifi_osal_mem_cpy(&set_key_cmd->key_info,
+			      key_info,
+			      sizeof(set_key_cmd->key_info));
+
+	set_key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_IDX_VALID;
+
+	status = umac_cmd_cfg(fmac_dev_ctx,
+			      set_key_cmd,
+			      sizeof(*set_key_cmd));
+
+out:
+	if (set_key_cmd) {
+		nrf_wifi_osal_mem_free(set_key_cmd);
+	}
+
+	return status;
+}
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_chg_sta(void *dev_ctx,
+					       unsigned char if_idx,
+					       struct nrf_wifi_umac_chg_sta_info *chg_sta_info)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_umac_cmd_chg_sta *chg_sta_cmd = NULL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	chg_sta_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*chg_sta_cmd));
+
+	if (!chg_sta_cmd) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate memory",
+				      __func__);
+		goto out;
+	}
+
+	chg_sta_cmd->umac_hdr.cmd_evnt = NRF_WIFI_UMAC_CMD_SET_STATION;
+	chg_sta_cmd->umac_hdr.ids.wdev_id = if_idx;
+	chg_sta_cmd->umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+
+	nrf_wifi_osal_mem_cpy(&chg_sta_cmd->info,
+			      chg_sta_info,
+			      sizeof(chg_sta_cmd->info));
+
+	if (chg_sta_info->aid) {
+		chg_sta_cmd->valid_fields |=
+			NRF_WIFI_CMD_SET_STATION_AID_VALID;
+	}
+
+
+	if (chg_sta_info->supported_channels.supported_channels_len > 0) {
+		chg_sta_cmd->valid_fields |=
+			NRF_WIFI_CMD_SET_STATION_SUPPORTED_CHANNELS_VALID;
+	}
+
+	if (chg_sta_info->supported_oper_classes.supported_oper_classes_len > 0) {
+		chg_sta_cmd->valid_fields |=
+			NRF_WIFI_CMD_SET_STATION_SUPPORTED_OPER_CLASSES_VALID;
+	}
+
+	chg_sta_cmd->valid_fields |= NRF_WIFI_CMD_SET_STATION_STA_FLAGS2_VALID;
+
+	if (chg_sta_info->opmode_notif) {
+		chg_sta_cmd->valid_fields |=
+			NRF_WIFI_CMD_SET_STATION_OPMODE_NOTIF_VALID;
+	}
+
+	if (chg_sta_info->wme_max_sp) {
+		chg_sta_cmd->valid_fields |=
+			NRF_WIFI_CMD_SET_STATION_STA_WME_MAX_SP_VALID;
+	}
+
+	status = umac_cmd_cfg(fmac_dev_ctx,
+			      chg_sta_cmd,
+			      sizeof(*chg_sta_cmd));
+
+out:
+	if (chg_sta_cmd) {
+		nrf_wifi_osal_mem_free(chg_sta_cmd);
+	}
+
+	return status;
+}
+
+#ifdef NRF_WIFI_TX_STATUS_REPORT
+enum nrf_wifi_status nrf_wifi_sys_fmac_peer_tx_stats_get(void *dev_ctx,
+							 unsigned char if_idx,
+							 const unsigned char *mac_addr,
+							 struct nrf_wifi_fmac_peer_tx_stats *stats)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct peers_info *peer = NULL;
+	int peer_id = -1;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !mac_addr || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx, mac_addr);
+
+	if (peer_id == -1) {
+		nrf_wifi_osal_log_dbg("%s: Peer not found",
+				      __func__);
+		goto unlock;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[peer_id];
+
+	if (peer->if_idx != if_idx) {
+		nrf_wifi_osal_log_dbg("%s: Peer not found on interface %d",
+				      __func__,
+				      if_idx);
+		goto unlock;
+	}
+
+	nrf_wifi_osal_mem_cpy(stats->tx_ok,
+			      peer->tx_ok,
+			      sizeof(stats->tx_ok));
+	nrf_wifi_osal_mem_cpy(stats->tx_fail,
+			      peer->tx_fail,
+			      sizeof(stats->tx_fail));
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+unlock:
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+out:
+	return status;
+}
+#endif /* NRF_WIFI_TX_STATUS_REPORT */
+
+#ifdef NRF_WIFI_TX_LATENCY_STATS
+static unsigned int tx_latency_percentile_get(const struct nrf_wifi_tx_latency_hist *hist,
+					      unsigned int percentile)
+{
+	unsigned int rank = 0;
+	unsigned int cum = 0;
+	unsigned int lo = 0;
+	unsigned int hi = 0;
+	unsigned int val = 0;
+	unsigned int i = 0;
+
+	if (!hist->num_samples) {
+		return 0;
+	}
+
+	rank = (unsigned int)((((unsigned long long)hist->num_samples * percentile) + 99) / 100);
+
+	if (!rank) {
+		rank = 1;
+	}
+
+	for (i = 0; i < NRF_WIFI_TX_LATENCY_BUCKETS; i++) {
+		if (cum + hist->buckets[i] >= rank) {
+			break;
+		}
+
+		cum += hist->buckets[i];
+	}
+
+	if (i == 0) {
+		return 0;
+	}
+
+	lo = 1U << (i - 1);
+	hi = (i < NRF_WIFI_TX_LATENCY_BUCKETS - 1) ? ((1U << i) - 1) : hist->max_us;
+
+	/* Assume the samples are spread evenly over the bucket */
+	val = lo + (unsigned int)(((unsigned long long)(hi - lo) * (rank - cum)) /
+				  hist->buckets[i]);
+
+	return (val > hist->max_us) ? hist->max_us : val;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_peer_tx_latency_get(void *dev_ctx,
+							   unsigned char if_idx,
+							   const unsigned char *mac_addr,
+							   unsigned char ac,
+							   struct nrf_wifi_fmac_tx_latency *latency)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	const struct nrf_wifi_tx_latency_hist *hist = NULL;
+	struct peers_info *peer = NULL;
+	int peer_id = -1;
+	unsigned int seg = 0;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !mac_addr || !latency || ac >= NRF_WIFI_FMAC_AC_MAX) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx, mac_addr);
+
+	if (peer_id == -1) {
+		nrf_wifi_osal_log_dbg("%s: Peer not found",
+				      __func__);
+		goto unlock;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[peer_id];
+
+	if (peer->if_idx != if_idx) {
+		nrf_wifi_osal_log_dbg("%s: Peer not found on interface %d",
+				      __func__,
+				      if_idx);
+		goto unlock;
+	}
+
+	for (seg = 0; seg < NRF_WIFI_TX_LATENCY_SEG_MAX; seg++) {
+		hist = &peer->tx_latency[ac][seg];
+
+		latency[seg].num_samples = hist->num_samples;
+		latency[seg].p50_us = tx_latency_percentile_get(hist, 50);
+		latency[seg].p90_us = tx_latency_percentile_get(hist, 90);
+		latency[seg].p99_us = tx_latency_percentile_get(hist, 99);
+		latency[seg].max_us = hist->max_us;
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+unlock:
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+out:
+	return status;
+}
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+
+#ifdef NRF_WIFI_LINK_STATS
+enum nrf_wifi_status nrf_wifi_sys_fmac_link_stats_get(void *dev_ctx,
+						      unsigned char if_idx,
+						      struct nrf_wifi_fmac_peer_link_stats *stats,
+						      unsigned int *num_peers)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_link_stats_entry *entry = NULL;
+	struct nrf_wifi_fmac_peer_link_stats *out = NULL;
+	struct peers_info *peer = NULL;
+	unsigned int i = 0;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !stats || !num_peers) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	*num_peers = 0;
+
+	/* The table is only written from the RX path */
+	nrf_wifi_sys_hal_lock_rx(fmac_dev_ctx->hal_dev_ctx);
+
+	for (i = 0; i < MAX_PEERS; i++) {
+		entry = &sys_dev_ctx->link_stats[i];
+		peer = &sys_dev_ctx->tx_config.peers[i];
+
+		if (!entry->valid || !entry->rx_pkts ||
+		    peer->peer_id == -1 ||
+		    peer->if_idx != if_idx ||
+		    !nrf_wifi_util_ether_addr_equal(entry->mac_addr, peer->ra_addr)) {
+			continue;
+		}
 
-out:
-	if (key_cmd) {
-		nrf_wifi_osal_mem_free(key_cmd);
+		out = &stats[(*num_peers)++];
+
+		nrf_wifi_osal_mem_cpy(out->mac_addr,
+				      entry->mac_addr,
+				      NRF_WIFI_ETH_ADDR_LEN);
+		out->signal_avg = entry->signal_avg / NRF_WIFI_LINK_STATS_SIG_SCALE;
+		out->signal_last = entry->signal_last;
+		out->rx_pkts = entry->rx_pkts;
+		nrf_wifi_osal_mem_cpy(out->rate_hist,
+				      entry->rate_hist,
+				      sizeof(out->rate_hist));
+		out->last_seen_ms = nrf_wifi_osal_time_elapsed_ms(entry->last_rx_ms);
 	}
 
+	nrf_wifi_sys_hal_unlock_rx(fmac_dev_ctx->hal_dev_ctx);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
 	return status;
 }
+#endif /* NRF_WIFI_LINK_STATS */
 
-enum nrf_wifi_status nrf_wifi_sys_fmac_del_key(void *dev_ctx,
-					       unsigned char if_idx,
-					       struct nrf_wifi_umac_key_info *key_info,
-					       const char *mac_addr)
+#ifdef NRF_WIFI_MCAST_TO_UCAST
+static struct nrf_wifi_fmac_vif_ctx *mc2uc_vif_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+						   unsigned char if_idx)
 {
-	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-	struct nrf_wifi_umac_cmd_key *key_cmd = NULL;
-	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
-	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
-
-	fmac_dev_ctx = dev_ctx;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
 
 	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
 		nrf_wifi_osal_log_err("%s: Invalid op mode",
 				      __func__);
-		goto out;
+		return NULL;
 	}
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
 
-	key_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*key_cmd));
+	if (!vif_ctx) {
+		nrf_wifi_osal_log_err("%s: VIF ctx does not exist",
+				      __func__);
+		return NULL;
+	}
 
-	if (!key_cmd) {
-		nrf_wifi_osal_log_err("%s: Unable to allocate memory",
+	if (vif_ctx->if_type != NRF_WIFI_IFTYPE_AP) {
+		nrf_wifi_osal_log_err("%s: Only supported on SoftAP interfaces",
 				      __func__);
-		goto out;
+		return NULL;
 	}
 
-	key_cmd->umac_hdr.cmd_evnt = NRF_WIFI_UMAC_CMD_DEL_KEY;
-	key_cmd->umac_hdr.ids.wdev_id = if_idx;
-	key_cmd->umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+	return vif_ctx;
+}
 
-	nrf_wifi_osal_mem_cpy(&key_cmd->key_info,
-			      key_info,
-			      sizeof(key_cmd->key_info));
 
-	if (mac_addr) {
-		nrf_wifi_osal_mem_cpy(key_cmd->mac_addr,
-				      mac_addr,
-				      NRF_WIFI_ETH_ADDR_LEN);
+enum nrf_wifi_status nrf_wifi_sys_fmac_mc2uc_set(void *dev_ctx,
+						 unsigned char if_idx,
+						 bool enable,
+						 bool snoop,
+						 unsigned char max_peers)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = dev_ctx;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
 
-		key_cmd->valid_fields |= NRF_WIFI_CMD_KEY_MAC_ADDR_VALID;
+	if (!fmac_dev_ctx || if_idx >= MAX_NUM_VIFS ||
+	    (enable && !max_peers)) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
 	}
 
-	key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_IDX_VALID;
-	key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_TYPE_VALID;
-
-	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+	vif_ctx = mc2uc_vif_get(fmac_dev_ctx,
+				if_idx);
 
-	if (key_info->key_type == NRF_WIFI_KEYTYPE_GROUP) {
-		vif_ctx->groupwise_cipher = 0;
+	if (!vif_ctx) {
+		goto out;
 	}
 
-	status = umac_cmd_cfg(fmac_dev_ctx,
-			      key_cmd,
-			      sizeof(*key_cmd));
+	vif_ctx->mc2uc_max_peers = max_peers;
+	vif_ctx->mc2uc_snoop = snoop;
+	vif_ctx->mc2uc_enabled = enable;
 
+	status = NRF_WIFI_STATUS_SUCCESS;
 out:
-	if (key_cmd) {
-		nrf_wifi_osal_mem_free(key_cmd);
-	}
-
 	return status;
 }
 
 
-enum nrf_wifi_status nrf_wifi_sys_fmac_set_key(void *dev_ctx,
-					       unsigned char if_idx,
-					       struct nrf_wifi_umac_key_info *key_info)
+enum nrf_wifi_status nrf_wifi_sys_fmac_mc2uc_stats_get(void *dev_ctx,
+						       unsigned char if_idx,
+						       struct nrf_wifi_fmac_mc2uc_stats *stats)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-	struct nrf_wifi_umac_cmd_set_key *set_key_cmd = NULL;
-	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
-
-	fmac_dev_ctx = dev_ctx;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = dev_ctx;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
 
-	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
-		nrf_wifi_osal_log_err("%s: Invalid op mode",
+	if (!fmac_dev_ctx || !stats || if_idx >= MAX_NUM_VIFS) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
 				      __func__);
 		goto out;
 	}
 
-	set_key_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*set_key_cmd));
+	vif_ctx = mc2uc_vif_get(fmac_dev_ctx,
+				if_idx);
 
-	if (!set_key_cmd) {
-		nrf_wifi_osal_log_err("%s: Unable to allocate memory",
-				      __func__);
+	if (!vif_ctx) {
 		goto out;
 	}
 
-	set_key_cmd->umac_hdr.cmd_evnt = NRF_WIFI_UMAC_CMD_SET_KEY;
-	set_key_cmd->umac_hdr.ids.wdev_id = if_idx;
-	set_key_cmd->umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
-	nrf_wifi_osal_mem_cpy(&set_key_cmd->key_info,
-			      key_info,
-			      sizeof(set_key_cmd->key_info));
+	/* The statistics are updated under the TX lock */
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
 
-	set_key_cmd->key_info.valid_fields |= NRF_WIFI_KEY_IDX_VALID;
+	nrf_wifi_osal_mem_cpy(stats,
+			      &vif_ctx->mc2uc_stats,
+			      sizeof(*stats));
 
-	status = umac_cmd_cfg(fmac_dev_ctx,
-			      set_key_cmd,
-			      sizeof(*set_key_cmd));
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
 
+	status = NRF_WIFI_STATUS_SUCCESS;
 out:
-	if (set_key_cmd) {
-		nrf_wifi_osal_mem_free(set_key_cmd);
-	}
-
 	return status;
 }
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
 
-enum nrf_wifi_status nrf_wifi_sys_fmac_chg_sta(void *dev_ctx,
-					       unsigned char if_idx,
-					       struct nrf_wifi_umac_chg_sta_info *chg_sta_info)
+#ifdef NRF_WIFI_UMAC_EVENT_STATS
+enum nrf_wifi_status nrf_wifi_sys_fmac_umac_event_stats_get(void *dev_ctx,
+							    struct nrf_wifi_fmac_umac_event_stats *stats)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
-	struct nrf_wifi_umac_cmd_chg_sta *chg_sta_cmd = NULL;
-	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = dev_ctx;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 
-	fmac_dev_ctx = dev_ctx;
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
 
 	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
 		nrf_wifi_osal_log_err("%s: Invalid op mode",
@@ -1306,61 +2216,102 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_chg_sta(void *dev_ctx,
 		goto out;
 	}
 
-	chg_sta_cmd = nrf_wifi_osal_mem_zalloc(sizeof(*chg_sta_cmd));
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
-	if (!chg_sta_cmd) {
-		nrf_wifi_osal_log_err("%s: Unable to allocate memory",
+	nrf_wifi_osal_mem_cpy(stats,
+			      sys_dev_ctx->umac_event_stats,
+			      sizeof(sys_dev_ctx->umac_event_stats));
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
+
+#ifdef NRF_WIFI_TX_SHAPING
+enum nrf_wifi_status nrf_wifi_sys_fmac_tx_shaping_set(void *dev_ctx,
+						      unsigned char if_idx,
+						      const unsigned char *mac_addr,
+						      unsigned char ac,
+						      unsigned int rate_kbps,
+						      unsigned int burst_bytes)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = dev_ctx;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	struct peers_info *peer = NULL;
+	int peer_id = -1;
+	int i = 0;
+
+	if (!fmac_dev_ctx || if_idx >= MAX_NUM_VIFS ||
+	    ac >= NRF_WIFI_FMAC_AC_MC ||
+	    (rate_kbps && !burst_bytes) ||
+	    (int)burst_bytes < 0) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
 				      __func__);
 		goto out;
 	}
 
-	chg_sta_cmd->umac_hdr.cmd_evnt = NRF_WIFI_UMAC_CMD_SET_STATION;
-	chg_sta_cmd->umac_hdr.ids.wdev_id = if_idx;
-	chg_sta_cmd->umac_hdr.ids.valid_fields |= NRF_WIFI_INDEX_IDS_WDEV_ID_VALID;
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
 
-	nrf_wifi_osal_mem_cpy(&chg_sta_cmd->info,
-			      chg_sta_info,
-			      sizeof(chg_sta_cmd->info));
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
 
-	if (chg_sta_info->aid) {
-		chg_sta_cmd->valid_fields |=
-			NRF_WIFI_CMD_SET_STATION_AID_VALID;
+	if (!vif_ctx) {
+		nrf_wifi_osal_log_err("%s: VIF ctx does not exist",
+				      __func__);
+		goto out;
 	}
 
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
 
-	if (chg_sta_info->supported_channels.supported_channels_len > 0) {
-		chg_sta_cmd->valid_fields |=
-			NRF_WIFI_CMD_SET_STATION_SUPPORTED_CHANNELS_VALID;
-	}
+	if (mac_addr) {
+		peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx,
+						    mac_addr);
 
-	if (chg_sta_info->supported_oper_classes.supported_oper_classes_len > 0) {
-		chg_sta_cmd->valid_fields |=
-			NRF_WIFI_CMD_SET_STATION_SUPPORTED_OPER_CLASSES_VALID;
-	}
+		if (peer_id == -1 || peer_id >= MAX_PEERS ||
+		    sys_dev_ctx->tx_config.peers[peer_id].if_idx != if_idx) {
+			nrf_wifi_osal_log_err("%s: Peer not found",
+					      __func__);
+			goto unlock;
+		}
 
-	chg_sta_cmd->valid_fields |= NRF_WIFI_CMD_SET_STATION_STA_FLAGS2_VALID;
+		tx_shaper_init(&sys_dev_ctx->tx_config.peers[peer_id].shaper[ac],
+			       rate_kbps,
+			       burst_bytes);
+	} else {
+		tx_shaper_init(&vif_ctx->tx_shaper[ac],
+			       rate_kbps,
+			       burst_bytes);
 
-	if (chg_sta_info->opmode_notif) {
-		chg_sta_cmd->valid_fields |=
-			NRF_WIFI_CMD_SET_STATION_OPMODE_NOTIF_VALID;
-	}
+		for (i = 0; i < MAX_PEERS; i++) {
+			peer = &sys_dev_ctx->tx_config.peers[i];
 
-	if (chg_sta_info->wme_max_sp) {
-		chg_sta_cmd->valid_fields |=
-			NRF_WIFI_CMD_SET_STATION_STA_WME_MAX_SP_VALID;
+			if (peer->peer_id == -1 || peer->if_idx != if_idx) {
+				continue;
+			}
+
+			tx_shaper_init(&peer->shaper[ac],
+				       rate_kbps,
+				       burst_bytes);
+		}
 	}
 
-	status = umac_cmd_cfg(fmac_dev_ctx,
-			      chg_sta_cmd,
-			      sizeof(*chg_sta_cmd));
+	/* Frames held back under the previous limit may be sent now */
+	tx_shaper_kick(fmac_dev_ctx);
 
+	status = NRF_WIFI_STATUS_SUCCESS;
+unlock:
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
 out:
-	if (chg_sta_cmd) {
-		nrf_wifi_osal_mem_free(chg_sta_cmd);
-	}
-
 	return status;
 }
+#endif /* NRF_WIFI_TX_SHAPING */
 
 #ifdef NRF70_AP_MODE
 enum nrf_wifi_status nrf_wifi_sys_fmac_set_bss(void *dev_ctx,
@@ -2215,6 +3166,10 @@ unsigned char nrf_wifi_sys_fmac_add_vif(void *dev_ctx,
 	}
 
 	sys_dev_ctx->vif_ctx[vif_idx] = vif_ctx;
+#ifdef NRF70_STA_MODE
+	/* The index may have been used by a VIF whose queues were stopped */
+	sys_dev_ctx->tx_config.txq_stopped_map[vif_idx] = 0;
+#endif /* NRF70_STA_MODE */
 
 	nrf_wifi_fmac_vif_incr_if_type(fmac_dev_ctx,
 				       vif_ctx->if_type);
@@ -2305,6 +3260,12 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_del_vif(void *dev_ctx,
 		status = NRF_WIFI_STATUS_SUCCESS;
 	}
 
+#ifdef NRF70_DATA_TX
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+	tx_flow_ctrl_vif_reset(fmac_dev_ctx, if_idx);
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#endif /* NRF70_DATA_TX */
+
 	nrf_wifi_fmac_vif_decr_if_type(fmac_dev_ctx, vif_ctx->if_type);
 
 out:
@@ -3602,32 +4563,13 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_rf_params_get(struct nrf_wifi_fmac_dev_ct
 
 	tx_pwr_ceil_params = fmac_dev_ctx->tx_pwr_ceil_params;
 
-	nrf_wifi_osal_mem_set(&otp_info,
-			      0xFF,
-			      sizeof(otp_info));
-
-	status = nrf_wifi_hal_otp_info_get(fmac_dev_ctx->hal_dev_ctx,
-					   &otp_info.info,
-					   &otp_info.flags);
-
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of RPU OTP information failed",
-				      __func__);
-		goto out;
-	}
-
-	status = nrf_wifi_hal_otp_ft_prog_ver_get(fmac_dev_ctx->hal_dev_ctx,
-						  &ft_prog_ver);
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of FT program version failed",
-				      __func__);
-		goto out;
-	}
+	status = nrf_wifi_fmac_otp_params_get(fmac_dev_ctx,
+					      &otp_info,
+					      &ft_prog_ver,
+					      &package_info);
 
-	status = nrf_wifi_hal_otp_pack_info_get(fmac_dev_ctx->hal_dev_ctx,
-						&package_info);
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: Fetching of Package info failed",
+		nrf_wifi_osal_log_err("%s: Fetching of OTP parameters failed",
 				      __func__);
 		goto out;
 	}
@@ -3847,6 +4789,80 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_set_packet_filter(void *dev_ctx, unsigned
 out:
 	return status;
 }
+
+#ifdef NRF_WIFI_SNIFFER_FILTER
+enum nrf_wifi_status nrf_wifi_sys_fmac_set_sniffer_filter(void *dev_ctx,
+							  unsigned char if_idx,
+							  const struct nrf_wifi_sniffer_filter_insn *insns,
+							  unsigned int num_insns)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = dev_ctx;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	struct nrf_wifi_sniffer_filter_insn *prog = NULL;
+
+	if (!fmac_dev_ctx || (num_insns && !insns) || if_idx >= MAX_NUM_VIFS) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+
+	if (!vif_ctx) {
+		nrf_wifi_osal_log_err("%s: VIF ctx does not exist",
+				      __func__);
+		goto out;
+	}
+
+	if (num_insns) {
+		prog = nrf_wifi_osal_mem_zalloc(sizeof(vif_ctx->sniffer_filter));
+
+		if (!prog) {
+			nrf_wifi_osal_log_err("%s: Unable to allocate memory for program",
+					      __func__);
+			goto out;
+		}
+
+		status = nrf_wifi_fmac_sniffer_filter_compile(insns,
+							      num_insns,
+							      prog);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			goto out;
+		}
+	}
+
+	/* The RX path runs the filter under the RX lock */
+	nrf_wifi_sys_hal_lock_rx(fmac_dev_ctx->hal_dev_ctx);
+
+	if (prog) {
+		nrf_wifi_osal_mem_cpy(vif_ctx->sniffer_filter,
+				      prog,
+				      sizeof(vif_ctx->sniffer_filter));
+	}
+
+	vif_ctx->sniffer_filter_len = num_insns;
+
+	nrf_wifi_sys_hal_unlock_rx(fmac_dev_ctx->hal_dev_ctx);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	if (prog) {
+		nrf_wifi_osal_mem_free(prog);
+	}
+
+	return status;
+}
+#endif /* NRF_WIFI_SNIFFER_FILTER */
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
 
 
@@ -0,0 +1,540 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief File containing host BSS cache specific definitions for the
+ * FMAC IF Layer of the Wi-Fi driver.
+ */
+
+#include "system/fmac_api.h"
+#include "system/fmac_bss_cache.h"
+#include "common/fmac_util.h"
+
+static int bss_cache_sig_get(const struct nrf_wifi_signal *signal)
+{
+	if (signal->signal_type == NRF_WIFI_SIGNAL_TYPE_MBM) {
+		return (int)signal->signal.mbm_signal;
+	}
+
+	/* Bring the 0..100 unspecified units to the same order as mBm */
+	if (signal->signal_type == NRF_WIFI_SIGNAL_TYPE_UNSPEC) {
+		return signal->signal.unspec_signal * 100;
+	}
+
+	return 0;
+}
+
+
+static void bss_cache_sig_set(struct nrf_wifi_signal *signal,
+			      int sig)
+{
+	if (signal->signal_type == NRF_WIFI_SIGNAL_TYPE_MBM) {
+		signal->signal.mbm_signal = (unsigned int)sig;
+	} else if (signal->signal_type == NRF_WIFI_SIGNAL_TYPE_UNSPEC) {
+		signal->signal.unspec_signal = sig / 100;
+	}
+}
+
+
+static bool bss_cache_res_changed(const struct umac_display_results *old_res,
+				  const struct umac_display_results *new_res)
+{
+	struct umac_display_results res;
+
+	/* Signal strength changes are tracked separately, with smoothing */
+	nrf_wifi_osal_mem_cpy(&res,
+			      new_res,
+			      sizeof(res));
+	res.signal = old_res->signal;
+
+	return nrf_wifi_osal_mem_cmp(&res,
+				     old_res,
+				     sizeof(res)) != 0;
+}
+
+
+static struct nrf_wifi_fmac_bss_cache_entry *
+bss_cache_find(struct nrf_wifi_fmac_bss_cache *cache,
+	       const struct umac_display_results *res)
+{
+	struct nrf_wifi_fmac_bss_cache_entry *entry = NULL;
+	int i;
+
+	for (i = 0; i < NRF_WIFI_BSS_CACHE_MAX_ENTRIES; i++) {
+		entry = &cache->entries[i];
+
+		if (entry->state == NRF_WIFI_BSS_CACHE_ENTRY_FREE) {
+			continue;
+		}
+
+		if (entry->res.nwk_band == res->nwk_band &&
+		    entry->res.nwk_channel == res->nwk_channel &&
+		    nrf_wifi_util_ether_addr_equal(entry->res.mac_addr,
+						   res->mac_addr)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+
+static struct nrf_wifi_fmac_bss_cache_entry *
+bss_cache_slot_get(struct nrf_wifi_fmac_bss_cache *cache)
+{
+	struct nrf_wifi_fmac_bss_cache_entry *entry = NULL;
+	struct nrf_wifi_fmac_bss_cache_entry *removed = NULL;
+	struct nrf_wifi_fmac_bss_cache_entry *oldest = NULL;
+	unsigned int age_ms = 0;
+	unsigned int oldest_age_ms = 0;
+	int i;
+
+	for (i = 0; i < NRF_WIFI_BSS_CACHE_MAX_ENTRIES; i++) {
+		entry = &cache->entries[i];
+
+		if (entry->state == NRF_WIFI_BSS_CACHE_ENTRY_FREE) {
+			return entry;
+		}
+
+		if (entry->state == NRF_WIFI_BSS_CACHE_ENTRY_REMOVED) {
+			if (!removed || entry->gen < removed->gen) {
+				removed = entry;
+			}
+			continue;
+		}
+
+		age_ms = nrf_wifi_osal_time_elapsed_ms(entry->last_seen_ms);
+
+		if (!oldest || age_ms > oldest_age_ms) {
+			oldest = entry;
+			oldest_age_ms = age_ms;
+		}
+	}
+
+	/* Consumers that have not yet seen the removal need a full resync */
+	if (removed) {
+		if (removed->gen > cache->resync_gen) {
+			cache->resync_gen = removed->gen;
+		}
+
+		return removed;
+	}
+
+	/* The evicted BSS is never reported as removed, the new entry takes
+	 * the next generation.
+	 */
+	cache->resync_gen = cache->gen + 1;
+
+	return oldest;
+}
+
+
+static bool bss_cache_merge(struct nrf_wifi_fmac_bss_cache *cache,
+			    const struct umac_display_results *res,
+			    unsigned long now_ms)
+{
+	struct nrf_wifi_fmac_bss_cache_entry *entry = NULL;
+	int sig = 0;
+	int sig_diff = 0;
+	bool changed = false;
+
+	sig = bss_cache_sig_get(&res->signal);
+
+	entry = bss_cache_find(cache, res);
+
+	if (!entry) {
+		entry = bss_cache_slot_get(cache);
+		entry->state = NRF_WIFI_BSS_CACHE_ENTRY_REMOVED;
+	}
+
+	if (entry->state == NRF_WIFI_BSS_CACHE_ENTRY_REMOVED) {
+		entry->state = NRF_WIFI_BSS_CACHE_ENTRY_VALID;
+		entry->sig_avg = sig * NRF_WIFI_BSS_CACHE_SIG_SCALE;
+		entry->sig_rep = sig;
+		changed = true;
+	} else {
+		entry->sig_avg += (sig * NRF_WIFI_BSS_CACHE_SIG_SCALE - entry->sig_avg) /
+			(1 << NRF_WIFI_BSS_CACHE_SIG_AVG_SHIFT);
+
+		sig_diff = entry->sig_avg / NRF_WIFI_BSS_CACHE_SIG_SCALE - entry->sig_rep;
+
+		if (sig_diff >= NRF_WIFI_BSS_CACHE_SIG_CHANGE_MBM ||
+		    sig_diff <= -NRF_WIFI_BSS_CACHE_SIG_CHANGE_MBM) {
+			entry->sig_rep = entry->sig_avg / NRF_WIFI_BSS_CACHE_SIG_SCALE;
+			changed = true;
+		}
+
+		if (bss_cache_res_changed(&entry->res, res)) {
+			changed = true;
+		}
+	}
+
+	nrf_wifi_osal_mem_cpy(&entry->res,
+			      res,
+			      sizeof(entry->res));
+
+	entry->last_seen_ms = now_ms;
+
+	if (changed) {
+		entry->gen = ++cache->gen;
+		cache->cur_stats.bss_changed++;
+	}
+
+	return changed;
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_bss_cache_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	cache->lock = nrf_wifi_osal_spinlock_alloc();
+
+	if (!cache->lock) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate lock",
+				      __func__);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	nrf_wifi_osal_spinlock_init(cache->lock);
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+void nrf_wifi_fmac_bss_cache_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	if (cache->lock) {
+		nrf_wifi_osal_spinlock_free(cache->lock);
+		cache->lock = NULL;
+	}
+}
+
+
+void nrf_wifi_fmac_bss_cache_scan_start(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+	struct nrf_wifi_fmac_bss_cache_entry *entry = NULL;
+	int i;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	if (!cache->lock) {
+		return;
+	}
+
+	nrf_wifi_osal_spinlock_take(cache->lock);
+
+	if (cache->cur_stats.events) {
+		cache->cur_stats.scan_cycles++;
+		cache->last_stats = cache->cur_stats;
+
+		nrf_wifi_osal_mem_set(&cache->cur_stats,
+				      0,
+				      sizeof(cache->cur_stats));
+		cache->cur_stats.scan_cycles = cache->last_stats.scan_cycles;
+	}
+
+	for (i = 0; i < NRF_WIFI_BSS_CACHE_MAX_ENTRIES; i++) {
+		entry = &cache->entries[i];
+
+		if (entry->state != NRF_WIFI_BSS_CACHE_ENTRY_VALID) {
+			continue;
+		}
+
+		if (nrf_wifi_osal_time_elapsed_ms(entry->last_seen_ms) <
+		    NRF_WIFI_BSS_CACHE_MAX_AGE_MS) {
+			continue;
+		}
+
+		entry->state = NRF_WIFI_BSS_CACHE_ENTRY_REMOVED;
+		entry->gen = ++cache->gen;
+		cache->cur_stats.bss_changed++;
+	}
+
+	nrf_wifi_osal_spinlock_rel(cache->lock);
+}
+
+
+unsigned int nrf_wifi_fmac_bss_cache_update(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					    struct nrf_wifi_umac_event_new_scan_display_results *scan_res,
+					    unsigned int event_len)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+	unsigned long now_ms = 0;
+	unsigned int num_bss = 0;
+	unsigned int num_changed = 0;
+	unsigned int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	if (!cache->lock) {
+		return event_len;
+	}
+
+	num_bss = scan_res->event_bss_count;
+
+	if (num_bss > DISPLAY_BSS_TOHOST_PEREVNT ||
+	    event_len < sizeof(*scan_res) - sizeof(scan_res->display_results) +
+			num_bss * sizeof(scan_res->display_results[0])) {
+		nrf_wifi_osal_log_err("%s: Invalid scan result event (%d BSSs, %d bytes)",
+				      __func__,
+				      num_bss,
+				      event_len);
+		return event_len;
+	}
+
+	now_ms = nrf_wifi_osal_time_get_curr_ms();
+
+	nrf_wifi_osal_spinlock_take(cache->lock);
+
+	cache->cur_stats.events++;
+	cache->cur_stats.bytes += event_len;
+	cache->cur_stats.bss_reported += num_bss;
+
+	for (i = 0; i < num_bss; i++) {
+		if (!bss_cache_merge(cache,
+				     &scan_res->display_results[i],
+				     now_ms)) {
+			continue;
+		}
+
+		/* Keep the changed BSSs at the front of the event */
+		if (cache->delta_only && num_changed != i) {
+			nrf_wifi_osal_mem_cpy(&scan_res->display_results[num_changed],
+					      &scan_res->display_results[i],
+					      sizeof(scan_res->display_results[0]));
+		}
+
+		num_changed++;
+	}
+
+	if (cache->delta_only) {
+		scan_res->event_bss_count = num_changed;
+		event_len = sizeof(*scan_res) - sizeof(scan_res->display_results) +
+			num_changed * sizeof(scan_res->display_results[0]);
+	}
+
+	nrf_wifi_osal_spinlock_rel(cache->lock);
+
+	return event_len;
+}
+
+
+void nrf_wifi_fmac_bss_cache_delivered(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				       struct nrf_wifi_umac_event_new_scan_display_results *scan_res,
+				       unsigned int event_len)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	if (!cache->lock) {
+		return;
+	}
+
+	nrf_wifi_osal_spinlock_take(cache->lock);
+
+	cache->cur_stats.os_events++;
+	cache->cur_stats.os_bytes += event_len;
+	cache->cur_stats.os_bss += scan_res->event_bss_count;
+
+	nrf_wifi_osal_spinlock_rel(cache->lock);
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_delta_set(void *dev_ctx,
+							   bool enable)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	if (!cache->lock) {
+		nrf_wifi_osal_log_err("%s: BSS cache not initialized",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(cache->lock);
+	cache->delta_only = enable;
+	nrf_wifi_osal_spinlock_rel(cache->lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_get(void *dev_ctx,
+						     unsigned int since_gen,
+						     struct nrf_wifi_fmac_bss_info *bss_info,
+						     unsigned int *num_bss,
+						     unsigned int *gen,
+						     bool *full)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+	struct nrf_wifi_fmac_bss_cache_entry *entry = NULL;
+	struct nrf_wifi_fmac_bss_info *info = NULL;
+	unsigned int count = 0;
+	int i;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !bss_info || !num_bss || !gen || !full) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	if (*num_bss < NRF_WIFI_BSS_CACHE_MAX_ENTRIES) {
+		nrf_wifi_osal_log_err("%s: Buffer too small (%d entries)",
+				      __func__,
+				      *num_bss);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	if (!cache->lock) {
+		nrf_wifi_osal_log_err("%s: BSS cache not initialized",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(cache->lock);
+
+	*full = (since_gen == 0) || (since_gen < cache->resync_gen);
+
+	if (*full) {
+		since_gen = 0;
+	}
+
+	for (i = 0; i < NRF_WIFI_BSS_CACHE_MAX_ENTRIES; i++) {
+		entry = &cache->entries[i];
+
+		if (entry->state == NRF_WIFI_BSS_CACHE_ENTRY_FREE ||
+		    entry->gen <= since_gen) {
+			continue;
+		}
+
+		if (*full && entry->state == NRF_WIFI_BSS_CACHE_ENTRY_REMOVED) {
+			continue;
+		}
+
+		info = &bss_info[count++];
+
+		nrf_wifi_osal_mem_cpy(&info->res,
+				      &entry->res,
+				      sizeof(info->res));
+
+		bss_cache_sig_set(&info->res.signal,
+				  entry->sig_avg / NRF_WIFI_BSS_CACHE_SIG_SCALE);
+
+		info->age_ms = nrf_wifi_osal_time_elapsed_ms(entry->last_seen_ms);
+		info->gen = entry->gen;
+		info->removed = (entry->state == NRF_WIFI_BSS_CACHE_ENTRY_REMOVED);
+	}
+
+	*gen = cache->gen;
+
+	nrf_wifi_osal_spinlock_rel(cache->lock);
+
+	*num_bss = count;
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+
+
+enum nrf_wifi_status nrf_wifi_sys_fmac_bss_cache_stats_get(void *dev_ctx,
+							   struct nrf_wifi_fmac_bss_cache_stats *stats)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_bss_cache *cache = NULL;
+
+	fmac_dev_ctx = dev_ctx;
+
+	if (!fmac_dev_ctx || !stats) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	if (fmac_dev_ctx->op_mode != NRF_WIFI_OP_MODE_SYS) {
+		nrf_wifi_osal_log_err("%s: Invalid op mode",
+				      __func__);
+		goto out;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	cache = &sys_dev_ctx->bss_cache;
+
+	if (!cache->lock) {
+		nrf_wifi_osal_log_err("%s: BSS cache not initialized",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_spinlock_take(cache->lock);
+
+	nrf_wifi_osal_mem_cpy(stats,
+			      &cache->last_stats,
+			      sizeof(*stats));
+
+	nrf_wifi_osal_spinlock_rel(cache->lock);
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
@@ -20,6 +20,10 @@
 #include "system/fmac_ap.h"
 #include "system/fmac_event.h"
 #include "common/fmac_util.h"
+#include "util.h"
+#ifdef NRF_WIFI_BSS_CACHE
+#include "system/fmac_bss_cache.h"
+#endif /* NRF_WIFI_BSS_CACHE */
 
 #ifdef NRF70_SYSTEM_WITH_RAW_MODES
 static enum nrf_wifi_status
@@ -283,6 +287,54 @@ static enum nrf_wifi_status umac_event_sys_proc_events(struct nrf_wifi_fmac_dev_
 }
 
 
+#if defined(NRF70_RX_WQ_ENABLED) || defined(NRF70_TX_DONE_WQ_ENABLED)
+static enum nrf_wifi_status data_event_defer(void *umac_head,
+					     void *event_q,
+					     void *tasklet,
+					     bool *tasklet_scheduled)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned int len = 0;
+	void *config = NULL;
+
+	/* Copy the whole event, including the per frame information */
+	len = ((struct nrf_wifi_umac_head *)umac_head)->len;
+
+	config = nrf_wifi_osal_mem_zalloc(len);
+
+	if (!config) {
+		nrf_wifi_osal_log_err("%s: Failed to allocate memory",
+				      __func__);
+		goto out;
+	}
+
+	nrf_wifi_osal_mem_cpy(config,
+			      umac_head,
+			      len);
+
+	status = nrf_wifi_utils_q_enqueue(event_q,
+					  config);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Failed to enqueue event",
+				      __func__);
+		nrf_wifi_osal_mem_free(config);
+		goto out;
+	}
+
+	/* The tasklet keeps polling the queue until it is drained, so it
+	 * only needs to be kicked for the first event.
+	 */
+	if (!*tasklet_scheduled) {
+		*tasklet_scheduled = true;
+		nrf_wifi_osal_tasklet_schedule(tasklet);
+	}
+out:
+	return status;
+}
+#endif /* NRF70_RX_WQ_ENABLED || NRF70_TX_DONE_WQ_ENABLED */
+
+
 static enum nrf_wifi_status
 nrf_wifi_fmac_data_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				 void *umac_head)
@@ -317,55 +369,23 @@ nrf_wifi_fmac_data_event_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 	switch (event) {
 	case NRF_WIFI_CMD_RX_BUFF:
-#ifdef NRF70_RX_DONE_WQ_ENABLED
-		struct nrf_wifi_rx_buff *config = nrf_wifi_osal_mem_zalloc(
-			sizeof(struct nrf_wifi_rx_buff));
-		if (!config) {
-			nrf_wifi_osal_log_err("%s: Failed to allocate memory (RX)",
-					      __func__);
-			status = NRF_WIFI_STATUS_FAIL;
-			break;
-		}
-		nrf_wifi_osal_mem_cpy(config,
-				      umac_head,
-				      sizeof(struct nrf_wifi_rx_buff));
-		status = nrf_wifi_utils_q_enqueue(sys_dev_ctx->rx_config.rx_tasklet_event_q,
-						  config);
-		if (status != NRF_WIFI_STATUS_SUCCESS) {
-			nrf_wifi_osal_log_err("%s: Failed to enqueue RX buffer",
-					      __func__);
-			nrf_wifi_osal_mem_free(config);
-			break;
-		}
-		nrf_wifi_osal_tasklet_schedule(sys_dev_ctx->rx_tasklet);
+#ifdef NRF70_RX_WQ_ENABLED
+		status = data_event_defer(umac_head,
+					  sys_dev_ctx->rx_tasklet_event_q,
+					  sys_dev_ctx->rx_tasklet,
+					  &sys_dev_ctx->rx_tasklet_scheduled);
 #else
 		status = nrf_wifi_fmac_rx_event_process(fmac_dev_ctx,
 							umac_head);
-#endif /* NRF70_RX_DONE_WQ_ENABLED */
+#endif /* NRF70_RX_WQ_ENABLED */
 		break;
 #ifdef NRF70_DATA_TX
 	case NRF_WIFI_CMD_TX_BUFF_DONE:
 #ifdef NRF70_TX_DONE_WQ_ENABLED
-		struct nrf_wifi_tx_buff_done *config = nrf_wifi_osal_mem_zalloc(
-					sizeof(struct nrf_wifi_tx_buff_done));
-		if (!config) {
-			nrf_wifi_osal_log_err("%s: Failed to allocate memory (TX)",
-					      __func__);
-			status = NRF_WIFI_STATUS_FAIL;
-			break;
-		}
-		nrf_wifi_osal_mem_cpy(config,
-				      umac_head,
-				      sizeof(struct nrf_wifi_tx_buff_done));
-		status = nrf_wifi_utils_q_enqueue(sys_dev_ctx->tx_config.tx_done_tasklet_event_q,
-						  config);
-		if (status != NRF_WIFI_STATUS_SUCCESS) {
-			nrf_wifi_osal_log_err("%s: Failed to enqueue TX buffer",
-					      __func__);
-			nrf_wifi_osal_mem_free(config);
-			break;
-		}
-		nrf_wifi_osal_tasklet_schedule(sys_dev_ctx->tx_done_tasklet);
+		status = data_event_defer(umac_head,
+					  sys_dev_ctx->tx_config.tx_done_tasklet_event_q,
+					  sys_dev_ctx->tx_done_tasklet,
+					  &sys_dev_ctx->tx_done_tasklet_scheduled);
 #else
 		status = nrf_wifi_fmac_tx_done_event_process(fmac_dev_ctx,
 								umac_head);
@@ -441,28 +461,21 @@ out:
 
 
 #ifdef NRF70_STA_MODE
-static void umac_event_connect(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
-			       void *event_data)
+static bool umac_event_connect(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			       struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			       struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			       void *event_data,
+			       unsigned int event_len)
 {
 	unsigned char if_index = 0;
 	int peer_id = -1;
-	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
 	struct nrf_wifi_umac_event_new_station *event = NULL;
-	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 
-	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 	event = (struct nrf_wifi_umac_event_new_station *)event_data;
 
+	/* The wdev_id has already been validated against vif_ctx */
 	if_index = event->umac_hdr.ids.wdev_id;
 
-	vif_ctx = sys_dev_ctx->vif_ctx[if_index];
-	if (if_index >= MAX_NUM_VIFS) {
-		nrf_wifi_osal_log_err("%s: Invalid wdev_id recd from UMAC %d",
-				      __func__,
-				      if_index);
-		return;
-	}
-
 	if (event->umac_hdr.cmd_evnt == NRF_WIFI_UMAC_EVENT_NEW_STATION) {
 		if (vif_ctx->if_type == 2) {
 			nrf_wifi_osal_mem_cpy(vif_ctx->bssid,
@@ -481,7 +494,7 @@ static void umac_event_connect(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			if (peer_id == -1) {
 				nrf_wifi_osal_log_err("%s:Can't add new station.",
 						      __func__);
-				return;
+				return true;
 			}
 		}
 	} else if (event->umac_hdr.cmd_evnt == NRF_WIFI_UMAC_EVENT_DEL_STATION) {
@@ -493,12 +506,775 @@ static void umac_event_connect(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		}
 	}
 
-	return;
+	return true;
+}
+#endif /* NRF70_STA_MODE */
+
+
+static bool umac_event_get_reg(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			       struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			       struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			       void *event_data,
+			       unsigned int event_len)
+{
+	if (!callbk_fns->event_get_reg) {
+		return false;
+	}
+
+	callbk_fns->event_get_reg(vif_ctx->os_vif_ctx,
+				  event_data,
+				  event_len);
+
+	return true;
+}
+
+
+static bool umac_event_reg_change(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+	if (!callbk_fns->reg_change_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->reg_change_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+
+
+static bool umac_event_scan_start(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+#ifdef NRF_WIFI_BSS_CACHE
+	nrf_wifi_fmac_bss_cache_scan_start(fmac_dev_ctx);
+#endif /* NRF_WIFI_BSS_CACHE */
+
+	if (!callbk_fns->scan_start_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->scan_start_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+
+
+static bool umac_event_scan_done(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				 struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				 struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				 void *event_data,
+				 unsigned int event_len)
+{
+	if (!callbk_fns->scan_done_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->scan_done_callbk_fn(vif_ctx->os_vif_ctx,
+					event_data,
+					event_len);
+
+	return true;
+}
+
+
+static bool umac_event_scan_abort(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+	if (!callbk_fns->scan_abort_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->scan_abort_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+
+
+static bool umac_event_disp_scan_res(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				     struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				     struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				     void *event_data,
+				     unsigned int event_len)
+{
+	struct nrf_wifi_umac_event_new_scan_display_results *scan_res = event_data;
+	bool more_res = (scan_res->umac_hdr.seq != 0);
+
+#ifdef NRF_WIFI_BSS_CACHE
+	event_len = nrf_wifi_fmac_bss_cache_update(fmac_dev_ctx,
+						   scan_res,
+						   event_len);
+
+	/* Nothing changed in this part of the results */
+	if (!scan_res->event_bss_count && more_res) {
+		return true;
+	}
+#endif /* NRF_WIFI_BSS_CACHE */
+
+	if (!callbk_fns->disp_scan_res_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->disp_scan_res_callbk_fn(vif_ctx->os_vif_ctx,
+					    scan_res,
+					    event_len,
+					    more_res);
+
+#ifdef NRF_WIFI_BSS_CACHE
+	nrf_wifi_fmac_bss_cache_delivered(fmac_dev_ctx,
+					  scan_res,
+					  event_len);
+#endif /* NRF_WIFI_BSS_CACHE */
+
+	return true;
+}
+
+
+static bool umac_event_ifflags_status(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				      struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				      struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				      void *event_data,
+				      unsigned int event_len)
+{
+	struct nrf_wifi_umac_event_vif_state *evnt_vif_state = event_data;
+
+	if (evnt_vif_state->status < 0) {
+		nrf_wifi_osal_log_err("%s: Failed to set interface flags: %d",
+				      __func__,
+				      evnt_vif_state->status);
+		return true;
+	}
+
+	vif_ctx->ifflags = true;
+
+	return true;
+}
+
+
+#if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX)
+static bool umac_event_set_if(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			      struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			      void *event_data,
+			      unsigned int event_len)
+{
+	if (!callbk_fns->set_if_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->set_if_callbk_fn(vif_ctx->os_vif_ctx,
+				     event_data,
+				     event_len);
+
+	return true;
+}
+#endif
+
+
+#ifdef NRF70_STA_MODE
+static bool umac_event_twt_sleep(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				 struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				 struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				 void *event_data,
+				 unsigned int event_len)
+{
+#ifdef NRF_WIFI_TWT_PRESTAGE
+	struct nrf_wifi_umac_event_twt_sleep *twt_sleep = event_data;
+
+	tx_twt_sleep_update(fmac_dev_ctx,
+			    twt_sleep->info.type);
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+
+	if (!callbk_fns->twt_sleep_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->twt_sleep_callbk_fn(vif_ctx->os_vif_ctx,
+					event_data,
+					event_len);
+
+	return true;
+}
+
+
+static bool umac_event_scan_res(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				void *event_data,
+				unsigned int event_len)
+{
+	if (!callbk_fns->scan_res_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->scan_res_callbk_fn(vif_ctx->os_vif_ctx,
+				       event_data,
+				       event_len,
+				       ((struct nrf_wifi_umac_hdr *)event_data)->seq != 0);
+
+	return true;
+}
+
+
+static bool umac_event_auth_resp(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				 struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				 struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				 void *event_data,
+				 unsigned int event_len)
+{
+	if (!callbk_fns->auth_resp_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->auth_resp_callbk_fn(vif_ctx->os_vif_ctx,
+					event_data,
+					event_len);
+
+	return true;
+}
+
+
+static bool umac_event_assoc_resp(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+	if (!callbk_fns->assoc_resp_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->assoc_resp_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+
+
+static bool umac_event_deauth(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			      struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			      void *event_data,
+			      unsigned int event_len)
+{
+	if (!callbk_fns->deauth_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->deauth_callbk_fn(vif_ctx->os_vif_ctx,
+				     event_data,
+				     event_len);
+
+	return true;
+}
+
+
+static bool umac_event_disassoc(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				void *event_data,
+				unsigned int event_len)
+{
+	if (!callbk_fns->disassoc_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->disassoc_callbk_fn(vif_ctx->os_vif_ctx,
+				       event_data,
+				       event_len);
+
+	return true;
+}
+
+
+static bool umac_event_mgmt_rx(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			       struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			       struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			       void *event_data,
+			       unsigned int event_len)
+{
+	if (!callbk_fns->mgmt_rx_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->mgmt_rx_callbk_fn(vif_ctx->os_vif_ctx,
+				      event_data,
+				      event_len);
+
+	return true;
+}
+
+
+static bool umac_event_tx_pwr_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+	if (!callbk_fns->tx_pwr_get_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->tx_pwr_get_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+
+
+static bool umac_event_chnl_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				void *event_data,
+				unsigned int event_len)
+{
+	if (!callbk_fns->chnl_get_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->chnl_get_callbk_fn(vif_ctx->os_vif_ctx,
+				       event_data,
+				       event_len);
 
+	return true;
+}
+
+
+static bool umac_event_get_station(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				   struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				   struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				   void *event_data,
+				   unsigned int event_len)
+{
+	if (!callbk_fns->get_station_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->get_station_callbk_fn(vif_ctx->os_vif_ctx,
+					  event_data,
+					  event_len);
+
+	return true;
+}
+
+
+static bool umac_event_get_interface(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				     struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				     struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				     void *event_data,
+				     unsigned int event_len)
+{
+	if (!callbk_fns->get_interface_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->get_interface_callbk_fn(vif_ctx->os_vif_ctx,
+					    event_data,
+					    event_len);
+
+	return true;
+}
+
+
+static bool umac_event_cookie_rsp(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+	if (!callbk_fns->cookie_rsp_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->cookie_rsp_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+
+
+static bool umac_event_mgmt_tx_status(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				      struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				      struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				      void *event_data,
+				      unsigned int event_len)
+{
+	if (!callbk_fns->mgmt_tx_status) {
+		return false;
+	}
+
+	callbk_fns->mgmt_tx_status(vif_ctx->os_vif_ctx,
+				   event_data,
+				   event_len);
+
+	return true;
+}
+
+
+static bool umac_event_unprot_mlme_mgmt_rx(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					   struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+					   struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+					   void *event_data,
+					   unsigned int event_len)
+{
+	if (!callbk_fns->unprot_mlme_mgmt_rx_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->unprot_mlme_mgmt_rx_callbk_fn(vif_ctx->os_vif_ctx,
+						  event_data,
+						  event_len);
+
+	return true;
+}
+
+
+static bool umac_event_twt_config(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+#ifdef NRF_WIFI_TWT_PRESTAGE
+	struct nrf_wifi_umac_cmd_config_twt *twt_config = event_data;
+
+	tx_twt_params_set(fmac_dev_ctx,
+			  &twt_config->info);
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+
+	if (!callbk_fns->twt_config_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->twt_config_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+
+
+static bool umac_event_twt_teardown(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				    struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				    struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				    void *event_data,
+				    unsigned int event_len)
+{
+#ifdef NRF_WIFI_TWT_PRESTAGE
+	tx_twt_params_set(fmac_dev_ctx,
+			  NULL);
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+
+	if (!callbk_fns->twt_teardown_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->twt_teardown_callbk_fn(vif_ctx->os_vif_ctx,
+					   event_data,
+					   event_len);
+
+	return true;
+}
+
+
+static bool umac_event_get_wiphy(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				 struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				 struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				 void *event_data,
+				 unsigned int event_len)
+{
+	if (!callbk_fns->event_get_wiphy) {
+		return false;
+	}
+
+	callbk_fns->event_get_wiphy(vif_ctx->os_vif_ctx,
+				    event_data,
+				    event_len);
+
+	return true;
+}
+
+
+static bool umac_event_cmd_status(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+#if WIFI_NRF70_LOG_LEVEL >= NRF_WIFI_LOG_LEVEL_DBG
+	struct nrf_wifi_umac_event_cmd_status *cmd_status = event_data;
+#endif
+
+	nrf_wifi_osal_log_dbg("%s: Command %d -> status %d",
+			      __func__,
+			      cmd_status->cmd_id,
+			      cmd_status->cmd_status);
+
+	return true;
+}
+
+
+static bool umac_event_nop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			   struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			   struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			   void *event_data,
+			   unsigned int event_len)
+{
+	/* Nothing to be done */
+	return true;
+}
+
+
+static bool umac_event_get_ps_info(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				   struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				   struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				   void *event_data,
+				   unsigned int event_len)
+{
+	if (!callbk_fns->event_get_ps_info) {
+		return false;
+	}
+
+	callbk_fns->event_get_ps_info(vif_ctx->os_vif_ctx,
+				      event_data,
+				      event_len);
+
+	return true;
+}
+
+
+#ifdef NRF70_P2P_MODE
+static bool umac_event_roc(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			   struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			   struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			   void *event_data,
+			   unsigned int event_len)
+{
+	if (!callbk_fns->roc_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->roc_callbk_fn(vif_ctx->os_vif_ctx,
+				  event_data,
+				  event_len);
+
+	return true;
+}
+
+
+static bool umac_event_roc_cancel(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				  void *event_data,
+				  unsigned int event_len)
+{
+	if (!callbk_fns->roc_cancel_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->roc_cancel_callbk_fn(vif_ctx->os_vif_ctx,
+					 event_data,
+					 event_len);
+
+	return true;
+}
+#endif /* NRF70_P2P_MODE */
+
+
+static bool umac_event_get_conn_info(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				     struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				     struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+				     void *event_data,
+				     unsigned int event_len)
+{
+	if (!callbk_fns->get_conn_info_callbk_fn) {
+		return false;
+	}
+
+	callbk_fns->get_conn_info_callbk_fn(vif_ctx->os_vif_ctx,
+					    event_data,
+					    event_len);
+
+	return true;
 }
 #endif /* NRF70_STA_MODE */
 
 
+/* Handlers of the UMAC control events, indexed by event ID. The minimum
+ * length covers what the FMAC layer itself reads from the event, the
+ * callbacks remain responsible for validating their payloads against the
+ * event length.
+ */
+struct umac_event_desc {
+	const char *name;
+	unsigned int min_len;
+	bool (*handler)(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			struct nrf_wifi_fmac_callbk_fns *callbk_fns,
+			void *event_data,
+			unsigned int event_len);
+};
+
+#define UMAC_EVENT_DESC(id, len, fn) \
+	[(id) - NRF_WIFI_UMAC_EVENT_UNSPECIFIED] = { #id, len, fn }
+
+static const struct umac_event_desc umac_event_descs[] = {
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_REG,
+			sizeof(struct nrf_wifi_reg),
+			umac_event_get_reg),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_REG_CHANGE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_reg_change),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_TRIGGER_SCAN_START,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_scan_start),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_DONE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_scan_done),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_ABORTED,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_scan_abort),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_DISPLAY_RESULT,
+			offsetof(struct nrf_wifi_umac_event_new_scan_display_results,
+				 display_results),
+			umac_event_disp_scan_res),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_IFFLAGS_STATUS,
+			sizeof(struct nrf_wifi_umac_event_vif_state),
+			umac_event_ifflags_status),
+#if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX)
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SET_INTERFACE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_set_if),
+#endif
+#ifdef NRF70_STA_MODE
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_TWT_SLEEP,
+			sizeof(struct nrf_wifi_umac_event_twt_sleep),
+			umac_event_twt_sleep),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_SCAN_RESULT,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_scan_res),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_AUTHENTICATE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_auth_resp),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_ASSOCIATE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_assoc_resp),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DEAUTHENTICATE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_deauth),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DISASSOCIATE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_disassoc),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_FRAME,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_mgmt_rx),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_TX_POWER,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_tx_pwr_get),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_CHANNEL,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_chnl_get),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_STATION,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_get_station),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_NEW_INTERFACE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_get_interface),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_COOKIE_RESP,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_cookie_rsp),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_FRAME_TX_STATUS,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_mgmt_tx_status),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_UNPROT_DEAUTHENTICATE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_unprot_mlme_mgmt_rx),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_UNPROT_DISASSOCIATE,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_unprot_mlme_mgmt_rx),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CONFIG_TWT,
+			sizeof(struct nrf_wifi_umac_cmd_config_twt),
+			umac_event_twt_config),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_TEARDOWN_TWT,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_twt_teardown),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_NEW_WIPHY,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_get_wiphy),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CMD_STATUS,
+			sizeof(struct nrf_wifi_umac_event_cmd_status),
+			umac_event_cmd_status),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_BEACON_HINT,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_nop),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CONNECT,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_nop),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DISCONNECT,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_nop),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_POWER_SAVE_INFO,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_get_ps_info),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_NEW_STATION,
+			offsetof(struct nrf_wifi_umac_event_new_station,
+				 sta_info),
+			umac_event_connect),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_DEL_STATION,
+			offsetof(struct nrf_wifi_umac_event_new_station,
+				 sta_info),
+			umac_event_connect),
+#ifdef NRF70_P2P_MODE
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_REMAIN_ON_CHANNEL,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_roc),
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_CANCEL_REMAIN_ON_CHANNEL,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_roc_cancel),
+#endif /* NRF70_P2P_MODE */
+	UMAC_EVENT_DESC(NRF_WIFI_UMAC_EVENT_GET_CONNECTION_INFO,
+			sizeof(struct nrf_wifi_umac_hdr),
+			umac_event_get_conn_info),
+#endif /* NRF70_STA_MODE */
+};
+
+
+static const struct umac_event_desc *umac_event_desc_get(unsigned int event_num)
+{
+	const struct umac_event_desc *desc = NULL;
+
+	if (event_num <= NRF_WIFI_UMAC_EVENT_UNSPECIFIED ||
+	    event_num - NRF_WIFI_UMAC_EVENT_UNSPECIFIED >= ARRAY_SIZE(umac_event_descs)) {
+		return NULL;
+	}
+
+	desc = &umac_event_descs[event_num - NRF_WIFI_UMAC_EVENT_UNSPECIFIED];
+
+	if (!desc->handler) {
+		return NULL;
+	}
+
+	return desc;
+}
+
+
 static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 						    void *event_data,
 						    unsigned int event_len)
@@ -507,12 +1283,16 @@ static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx
 	struct nrf_wifi_umac_hdr *umac_hdr = NULL;
 	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
 	struct nrf_wifi_fmac_callbk_fns *callbk_fns = NULL;
-	struct nrf_wifi_umac_event_vif_state *evnt_vif_state = NULL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
-	bool more_res = false;
+	const struct umac_event_desc *desc = NULL;
 	unsigned char if_id = 0;
 	unsigned int event_num = 0;
+#ifdef NRF_WIFI_UMAC_EVENT_STATS
+	struct nrf_wifi_fmac_umac_event_stats *stats = NULL;
+	unsigned long start_time_us = 0;
+	unsigned int handler_us = 0;
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
 
 	if (!fmac_dev_ctx || !event_data) {
 		nrf_wifi_osal_log_err("%s: Invalid parameters",
@@ -527,6 +1307,14 @@ static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx
 		goto out;
 	}
 
+	/* The event length includes the RPU message header */
+	if (event_len < sizeof(struct host_rpu_msg) + sizeof(*umac_hdr)) {
+		nrf_wifi_osal_log_err("%s: Invalid event length %d",
+				      __func__,
+				      event_len);
+		goto out;
+	}
+
 	umac_hdr = event_data;
 	if_id = umac_hdr->ids.wdev_id;
 	event_num = umac_hdr->cmd_evnt;
@@ -546,357 +1334,68 @@ static enum nrf_wifi_status umac_event_ctrl_process(struct nrf_wifi_fmac_dev_ctx
 		goto out;
 	}
 	callbk_fns = &sys_fpriv->callbk_fns;
-	if (!callbk_fns) {
-		nrf_wifi_osal_log_err("%s: Invalid callbk_fns",
-				      __func__);
+
+	desc = umac_event_desc_get(event_num);
+
+	if (!desc) {
+		nrf_wifi_osal_log_dbg("%s: No callback registered for event %d",
+				      __func__,
+				      event_num);
 		goto out;
 	}
 
 #ifdef NRF_WIFI_CMD_EVENT_LOG
-	nrf_wifi_osal_log_info("%s: Event %d received from UMAC",
+	nrf_wifi_osal_log_info("%s: Event %s (%d) received from UMAC",
 			      __func__,
+			      desc->name,
 			      event_num);
 #else
-	nrf_wifi_osal_log_dbg("%s: Event %d received from UMAC",
+	nrf_wifi_osal_log_dbg("%s: Event %s (%d) received from UMAC",
 			      __func__,
+			      desc->name,
 			      event_num);
 #endif /* NRF_WIFI_CMD_EVENT_LOG */
 
-	switch (umac_hdr->cmd_evnt) {
-	case NRF_WIFI_UMAC_EVENT_GET_REG:
-		if (callbk_fns->event_get_reg)
-			callbk_fns->event_get_reg(vif_ctx->os_vif_ctx,
-						      event_data,
-						      event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_REG_CHANGE:
-		if (callbk_fns->reg_change_callbk_fn)
-			callbk_fns->reg_change_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_TRIGGER_SCAN_START:
-		if (callbk_fns->scan_start_callbk_fn)
-			callbk_fns->scan_start_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_DONE:
-		if (callbk_fns->scan_done_callbk_fn)
-			callbk_fns->scan_done_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_ABORTED:
-		if (callbk_fns->scan_abort_callbk_fn)
-			callbk_fns->scan_abort_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_DISPLAY_RESULT:
-		if (umac_hdr->seq != 0)
-			more_res = true;
-
-		if (callbk_fns->disp_scan_res_callbk_fn)
-			callbk_fns->disp_scan_res_callbk_fn(vif_ctx->os_vif_ctx,
-							    event_data,
-							    event_len,
-							    more_res);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_IFFLAGS_STATUS:
-		evnt_vif_state = (struct nrf_wifi_umac_event_vif_state *)event_data;
+#ifdef NRF_WIFI_UMAC_EVENT_STATS
+	stats = &sys_dev_ctx->umac_event_stats[event_num - NRF_WIFI_UMAC_EVENT_UNSPECIFIED];
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
 
-		if (evnt_vif_state->status < 0) {
-			nrf_wifi_osal_log_err("%s: Failed to set interface flags: %d",
-					      __func__,
-						evnt_vif_state->status);
-			goto out;
-		}
-		vif_ctx->ifflags = true;
-		break;
-#if defined(NRF70_STA_MODE) || defined(NRF70_RAW_DATA_RX)
-	case NRF_WIFI_UMAC_EVENT_SET_INTERFACE:
-		if (callbk_fns->set_if_callbk_fn)
-			callbk_fns->set_if_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#endif
-#ifdef NRF70_STA_MODE
-	case NRF_WIFI_UMAC_EVENT_TWT_SLEEP:
-		if (callbk_fns->twt_sleep_callbk_fn)
-			callbk_fns->twt_sleep_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_SCAN_RESULT:
-		if (umac_hdr->seq != 0)
-			more_res = true;
-
-		if (callbk_fns->scan_res_callbk_fn)
-			callbk_fns->scan_res_callbk_fn(vif_ctx->os_vif_ctx,
-						       event_data,
-						       event_len,
-						       more_res);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_AUTHENTICATE:
-		if (callbk_fns->auth_resp_callbk_fn)
-			callbk_fns->auth_resp_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_ASSOCIATE:
-		if (callbk_fns->assoc_resp_callbk_fn)
-			callbk_fns->assoc_resp_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_DEAUTHENTICATE:
-		if (callbk_fns->deauth_callbk_fn)
-			callbk_fns->deauth_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_DISASSOCIATE:
-		if (callbk_fns->disassoc_callbk_fn)
-			callbk_fns->disassoc_callbk_fn(vif_ctx->os_vif_ctx,
-						       event_data,
-						       event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_FRAME:
-		if (callbk_fns->mgmt_rx_callbk_fn)
-			callbk_fns->mgmt_rx_callbk_fn(vif_ctx->os_vif_ctx,
-						      event_data,
-						      event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_TX_POWER:
-		if (callbk_fns->tx_pwr_get_callbk_fn)
-			callbk_fns->tx_pwr_get_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_CHANNEL:
-		if (callbk_fns->chnl_get_callbk_fn)
-			callbk_fns->chnl_get_callbk_fn(vif_ctx->os_vif_ctx,
-						       event_data,
-						       event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_STATION:
-		if (callbk_fns->get_station_callbk_fn)
-			callbk_fns->get_station_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_NEW_INTERFACE:
-		if (callbk_fns->get_interface_callbk_fn)
-			callbk_fns->get_interface_callbk_fn(vif_ctx->os_vif_ctx,
-						     event_data,
-						     event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_COOKIE_RESP:
-		if (callbk_fns->cookie_rsp_callbk_fn)
-			callbk_fns->cookie_rsp_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_FRAME_TX_STATUS:
-		if (callbk_fns->mgmt_tx_status)
-			callbk_fns->mgmt_tx_status(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_UNPROT_DEAUTHENTICATE:
-	case NRF_WIFI_UMAC_EVENT_UNPROT_DISASSOCIATE:
-		if (callbk_fns->unprot_mlme_mgmt_rx_callbk_fn)
-			callbk_fns->unprot_mlme_mgmt_rx_callbk_fn(vif_ctx->os_vif_ctx,
-								  event_data,
-								  event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_CONFIG_TWT:
-		if (callbk_fns->twt_config_callbk_fn)
-			callbk_fns->twt_config_callbk_fn(vif_ctx->os_vif_ctx,
-							event_data,
-							event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_TEARDOWN_TWT:
-		if (callbk_fns->twt_teardown_callbk_fn)
-			callbk_fns->twt_teardown_callbk_fn(vif_ctx->os_vif_ctx,
-							   event_data,
-							   event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_NEW_WIPHY:
-		if (callbk_fns->event_get_wiphy)
-			callbk_fns->event_get_wiphy(vif_ctx->os_vif_ctx,
-						    event_data,
-						    event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_CMD_STATUS:
-#if WIFI_NRF70_LOG_LEVEL >= NRF_WIFI_LOG_LEVEL_DBG
-		struct nrf_wifi_umac_event_cmd_status *cmd_status =
-			(struct nrf_wifi_umac_event_cmd_status *)event_data;
-#endif
-		nrf_wifi_osal_log_dbg("%s: Command %d -> status %d",
+	if (event_len - sizeof(struct host_rpu_msg) < desc->min_len) {
+		nrf_wifi_osal_log_err("%s: Event %s too short (%d < %d)",
 				      __func__,
-				      cmd_status->cmd_id,
-				      cmd_status->cmd_status);
-		break;
-	case NRF_WIFI_UMAC_EVENT_BEACON_HINT:
-	case NRF_WIFI_UMAC_EVENT_CONNECT:
-	case NRF_WIFI_UMAC_EVENT_DISCONNECT:
-		/* Nothing to be done */
-		break;
-	case NRF_WIFI_UMAC_EVENT_GET_POWER_SAVE_INFO:
-		if (callbk_fns->event_get_ps_info)
-			callbk_fns->event_get_ps_info(vif_ctx->os_vif_ctx,
-						      event_data,
-						      event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#ifdef NRF70_STA_MODE
-	case NRF_WIFI_UMAC_EVENT_NEW_STATION:
-	case NRF_WIFI_UMAC_EVENT_DEL_STATION:
-		umac_event_connect(fmac_dev_ctx,
-				   event_data);
-		break;
-#endif /* NRF70_STA_MODE */
-#ifdef NRF70_P2P_MODE
-	case NRF_WIFI_UMAC_EVENT_REMAIN_ON_CHANNEL:
-		if (callbk_fns->roc_callbk_fn)
-			callbk_fns->roc_callbk_fn(vif_ctx->os_vif_ctx,
-						  event_data,
-						  event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-	case NRF_WIFI_UMAC_EVENT_CANCEL_REMAIN_ON_CHANNEL:
-		if (callbk_fns->roc_cancel_callbk_fn)
-			callbk_fns->roc_cancel_callbk_fn(vif_ctx->os_vif_ctx,
-							 event_data,
-							 event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#endif /* NRF70_P2P_MODE */
-	case NRF_WIFI_UMAC_EVENT_GET_CONNECTION_INFO:
-		if (callbk_fns->get_conn_info_callbk_fn)
-			callbk_fns->get_conn_info_callbk_fn(vif_ctx->os_vif_ctx,
-							    event_data,
-							    event_len);
-		else
-			nrf_wifi_osal_log_err("%s: No callback registered for event %d",
-					      __func__,
-					      umac_hdr->cmd_evnt);
-		break;
-#endif /* NRF70_STA_MODE */
-	default:
-		nrf_wifi_osal_log_dbg("%s: No callback registered for event %d",
+				      desc->name,
+				      (unsigned int)(event_len - sizeof(struct host_rpu_msg)),
+				      desc->min_len);
+#ifdef NRF_WIFI_UMAC_EVENT_STATS
+		stats->rejected++;
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
+		goto out;
+	}
+
+#ifdef NRF_WIFI_UMAC_EVENT_STATS
+	start_time_us = nrf_wifi_osal_time_get_curr_us();
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
+
+	if (!desc->handler(fmac_dev_ctx,
+			   vif_ctx,
+			   callbk_fns,
+			   event_data,
+			   event_len)) {
+		nrf_wifi_osal_log_err("%s: No callback registered for event %d",
 				      __func__,
-				      umac_hdr->cmd_evnt);
-		break;
+				      event_num);
+	}
+
+#ifdef NRF_WIFI_UMAC_EVENT_STATS
+	handler_us = nrf_wifi_osal_time_elapsed_us(start_time_us);
+
+	stats->count++;
+	stats->total_us += handler_us;
+
+	if (handler_us > stats->max_us) {
+		stats->max_us = handler_us;
 	}
+#endif /* NRF_WIFI_UMAC_EVENT_STATS */
 
 	nrf_wifi_osal_log_dbg("%s: Event %d processed",
 			      __func__,
@@ -921,6 +1420,15 @@ enum nrf_wifi_status nrf_wifi_sys_fmac_event_callback(void *mac_dev_ctx,
 	fmac_dev_ctx = (struct nrf_wifi_fmac_dev_ctx *)mac_dev_ctx;
 
 	rpu_msg = (struct host_rpu_msg *)rpu_event_data;
+
+	if (rpu_event_len < sizeof(*rpu_msg) ||
+	    rpu_msg->hdr.len > rpu_event_len) {
+		nrf_wifi_osal_log_err("%s: Invalid event length %d",
+				      __func__,
+				      rpu_event_len);
+		goto out;
+	}
+
 	umac_hdr = (struct nrf_wifi_umac_hdr *)rpu_msg->msg;
 	umac_msg_len = rpu_msg->hdr.len;
 	umac_msg_type = umac_hdr->cmd_evnt;
@@ -0,0 +1,441 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief File containing SoftAP multicast to unicast conversion specific
+ * definitions for the FMAC IF Layer of the Wi-Fi driver.
+ */
+
+#include "osal_api.h"
+#include "system/fmac_mc2uc.h"
+#include "system/fmac_peer.h"
+#include "common/fmac_util.h"
+
+#define MC2UC_IGMP_V1_REPORT 0x12
+#define MC2UC_IGMP_V2_REPORT 0x16
+#define MC2UC_IGMP_V2_LEAVE 0x17
+#define MC2UC_IGMP_V3_REPORT 0x22
+#define MC2UC_MLD_V1_REPORT 131
+#define MC2UC_MLD_V1_DONE 132
+#define MC2UC_MLD_V2_REPORT 143
+
+/* Group record types, common to IGMPv3 (RFC 3376) and MLDv2 (RFC 3810) */
+#define MC2UC_REC_MODE_IS_INCLUDE 1
+#define MC2UC_REC_MODE_IS_EXCLUDE 2
+#define MC2UC_REC_CHANGE_TO_INCLUDE 3
+#define MC2UC_REC_CHANGE_TO_EXCLUDE 4
+#define MC2UC_REC_ALLOW_NEW_SOURCES 5
+
+#define MC2UC_IPV4_ADDR_LEN 4
+#define MC2UC_IPV6_ADDR_LEN 16
+
+static const unsigned char mc2uc_bcast_addr[NRF_WIFI_FMAC_ETH_ADDR_LEN] = {
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+static void mc2uc_group_mac_get(const unsigned char *group,
+				unsigned int addr_len,
+				unsigned char *group_mac)
+{
+	if (addr_len == MC2UC_IPV4_ADDR_LEN) {
+		group_mac[0] = 0x01;
+		group_mac[1] = 0x00;
+		group_mac[2] = 0x5E;
+		group_mac[3] = group[1] & 0x7F;
+		group_mac[4] = group[2];
+		group_mac[5] = group[3];
+	} else {
+		group_mac[0] = 0x33;
+		group_mac[1] = 0x33;
+		nrf_wifi_osal_mem_cpy(&group_mac[2],
+				      &group[12],
+				      4);
+	}
+}
+
+
+/* Groups which are flooded regardless of the reports: the link local
+ * control groups (224.0.0.x and ffx2::x) and the IPv6 solicited node
+ * groups, so that ND does not depend on the peer sending MLD reports.
+ */
+static bool mc2uc_group_is_flooded(const unsigned char *da)
+{
+	if (da[0] == 0x01 && da[1] == 0x00 && da[2] == 0x5E &&
+	    da[3] == 0x00 && da[4] == 0x00) {
+		return true;
+	}
+
+	if (da[0] == 0x33 && da[1] == 0x33) {
+		return (da[2] == 0xFF) ||
+			(da[2] == 0x00 && da[3] == 0x00 && da[4] == 0x00);
+	}
+
+	return false;
+}
+
+
+static bool mc2uc_peer_is_member(struct peers_info *peer,
+				 const unsigned char *da)
+{
+	unsigned int i = 0;
+
+	if (peer->mc_groups_overflow) {
+		return true;
+	}
+
+	for (i = 0; i < peer->num_mc_groups; i++) {
+		if (nrf_wifi_util_ether_addr_equal(peer->mc_groups[i],
+						   da)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+int nrf_wifi_fmac_mc2uc_peers_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  unsigned char if_idx,
+				  void *nwb,
+				  struct nrf_wifi_fmac_mc2uc_peer *peers)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	struct peers_info *peer = NULL;
+	unsigned char *data = NULL;
+	unsigned short eth_type = 0;
+	bool flooded = false;
+	int num_peers = 0;
+	int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+
+	if (!vif_ctx || !vif_ctx->mc2uc_enabled) {
+		return -1;
+	}
+
+	data = nrf_wifi_osal_nbuf_data_get(nwb);
+	eth_type = nrf_wifi_util_tx_get_eth_type(data);
+
+	/* Broadcast is mostly low rate control traffic (ARP, DHCP), only
+	 * IP multicast streams are worth the copies.
+	 */
+	if (!nrf_wifi_util_is_multicast_addr(data) ||
+	    nrf_wifi_util_ether_addr_equal(data, mc2uc_bcast_addr) ||
+	    ((eth_type != NRF_WIFI_FMAC_ETH_P_IP) &&
+	     (eth_type != NRF_WIFI_FMAC_ETH_P_IPV6))) {
+		return -1;
+	}
+
+	flooded = !vif_ctx->mc2uc_snoop || mc2uc_group_is_flooded(data);
+
+	/* The group lists are updated by the RX snoop under the TX lock */
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	for (i = 0; i < MAX_PEERS; i++) {
+		peer = &sys_dev_ctx->tx_config.peers[i];
+
+		if (peer->peer_id != i || peer->if_idx != if_idx) {
+			continue;
+		}
+
+		if (!flooded && !mc2uc_peer_is_member(peer, data)) {
+			continue;
+		}
+
+		if (num_peers == vif_ctx->mc2uc_max_peers) {
+			vif_ctx->mc2uc_stats.fallback++;
+			num_peers = -1;
+			goto out;
+		}
+
+		peers[num_peers].peer_id = i;
+		peers[num_peers].qos_supported = peer->qos_supported;
+
+		nrf_wifi_osal_mem_cpy(peers[num_peers].ra_addr,
+				      peer->ra_addr,
+				      NRF_WIFI_FMAC_ETH_ADDR_LEN);
+
+		num_peers++;
+	}
+
+	if (!num_peers) {
+		vif_ctx->mc2uc_stats.no_member++;
+	}
+out:
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	return num_peers;
+}
+
+
+/* Several IPv4 groups share a MAC address, a leave for one of them stops
+ * the others for that peer until its next report.
+ */
+static void mc2uc_group_update(struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			       struct peers_info *peer,
+			       const unsigned char *group,
+			       unsigned int addr_len,
+			       bool join)
+{
+	unsigned char group_mac[NRF_WIFI_FMAC_ETH_ADDR_LEN];
+	unsigned int i = 0;
+
+	mc2uc_group_mac_get(group,
+			    addr_len,
+			    group_mac);
+
+	for (i = 0; i < peer->num_mc_groups; i++) {
+		if (nrf_wifi_util_ether_addr_equal(peer->mc_groups[i],
+						   group_mac)) {
+			break;
+		}
+	}
+
+	if (join) {
+		vif_ctx->mc2uc_stats.joins++;
+
+		if (i < peer->num_mc_groups) {
+			return;
+		}
+
+		if (peer->num_mc_groups == NRF_WIFI_MC2UC_MAX_GROUPS) {
+			peer->mc_groups_overflow = true;
+			return;
+		}
+
+		nrf_wifi_osal_mem_cpy(peer->mc_groups[peer->num_mc_groups++],
+				      group_mac,
+				      NRF_WIFI_FMAC_ETH_ADDR_LEN);
+	} else {
+		vif_ctx->mc2uc_stats.leaves++;
+
+		if (i == peer->num_mc_groups) {
+			return;
+		}
+
+		peer->num_mc_groups--;
+
+		nrf_wifi_osal_mem_cpy(peer->mc_groups[i],
+				      peer->mc_groups[peer->num_mc_groups],
+				      NRF_WIFI_FMAC_ETH_ADDR_LEN);
+	}
+}
+
+
+static void mc2uc_report_parse(struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			       struct peers_info *peer,
+			       const unsigned char *rec,
+			       unsigned int len,
+			       unsigned int num_recs,
+			       unsigned int addr_len)
+{
+	unsigned int num_srcs = 0;
+	unsigned int rec_len = 0;
+
+	while (num_recs-- && (len >= 4 + addr_len)) {
+		num_srcs = (rec[2] << 8) | rec[3];
+		rec_len = 4 + addr_len + (num_srcs * addr_len) + (rec[1] * 4);
+
+		if (rec_len > len) {
+			return;
+		}
+
+		switch (rec[0]) {
+		case MC2UC_REC_MODE_IS_EXCLUDE:
+		case MC2UC_REC_CHANGE_TO_EXCLUDE:
+			mc2uc_group_update(vif_ctx, peer, rec + 4, addr_len, true);
+			break;
+		case MC2UC_REC_MODE_IS_INCLUDE:
+		case MC2UC_REC_CHANGE_TO_INCLUDE:
+			/* INCLUDE with no sources is how v3/v2 report a leave */
+			mc2uc_group_update(vif_ctx, peer, rec + 4, addr_len, num_srcs != 0);
+			break;
+		case MC2UC_REC_ALLOW_NEW_SOURCES:
+			if (num_srcs) {
+				mc2uc_group_update(vif_ctx, peer, rec + 4, addr_len, true);
+			}
+			break;
+		default:
+			break;
+		}
+
+		rec += rec_len;
+		len -= rec_len;
+	}
+}
+
+
+static void mc2uc_igmp_parse(struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			     struct peers_info *peer,
+			     const unsigned char *igmp,
+			     unsigned int len)
+{
+	if (len < 8) {
+		return;
+	}
+
+	switch (igmp[0]) {
+	case MC2UC_IGMP_V1_REPORT:
+	case MC2UC_IGMP_V2_REPORT:
+		mc2uc_group_update(vif_ctx, peer, igmp + 4, MC2UC_IPV4_ADDR_LEN, true);
+		break;
+	case MC2UC_IGMP_V2_LEAVE:
+		mc2uc_group_update(vif_ctx, peer, igmp + 4, MC2UC_IPV4_ADDR_LEN, false);
+		break;
+	case MC2UC_IGMP_V3_REPORT:
+		mc2uc_report_parse(vif_ctx,
+				   peer,
+				   igmp + 8,
+				   len - 8,
+				   (igmp[6] << 8) | igmp[7],
+				   MC2UC_IPV4_ADDR_LEN);
+		break;
+	default:
+		break;
+	}
+}
+
+
+static void mc2uc_mld_parse(struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+			    struct peers_info *peer,
+			    const unsigned char *mld,
+			    unsigned int len)
+{
+	if (len < 8) {
+		return;
+	}
+
+	switch (mld[0]) {
+	case MC2UC_MLD_V1_REPORT:
+	case MC2UC_MLD_V1_DONE:
+		if (len < 8 + MC2UC_IPV6_ADDR_LEN) {
+			return;
+		}
+
+		mc2uc_group_update(vif_ctx,
+				   peer,
+				   mld + 8,
+				   MC2UC_IPV6_ADDR_LEN,
+				   mld[0] == MC2UC_MLD_V1_REPORT);
+		break;
+	case MC2UC_MLD_V2_REPORT:
+		mc2uc_report_parse(vif_ctx,
+				   peer,
+				   mld + 8,
+				   len - 8,
+				   (mld[6] << 8) | mld[7],
+				   MC2UC_IPV6_ADDR_LEN);
+		break;
+	default:
+		break;
+	}
+}
+
+
+void nrf_wifi_fmac_mc2uc_rx_snoop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+				  void *nwb)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct peers_info *peer = NULL;
+	unsigned char *data = NULL;
+	unsigned char *ip_hdr = NULL;
+	unsigned int len = 0;
+	unsigned int ip_hdr_len = 0;
+	unsigned int ip_len = 0;
+	unsigned char next_hdr = 0;
+	int peer_id = -1;
+
+	if (!vif_ctx->mc2uc_enabled || !vif_ctx->mc2uc_snoop) {
+		return;
+	}
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	data = nrf_wifi_osal_nbuf_data_get(nwb);
+	len = nrf_wifi_osal_nbuf_data_size(nwb);
+
+	if (len < NRF_WIFI_FMAC_ETH_HDR_LEN) {
+		return;
+	}
+
+	peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx,
+					    data + NRF_WIFI_FMAC_ETH_ADDR_LEN);
+
+	if (peer_id < 0 || peer_id >= MAX_PEERS) {
+		return;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[peer_id];
+
+	ip_hdr = data + NRF_WIFI_FMAC_ETH_HDR_LEN;
+	len -= NRF_WIFI_FMAC_ETH_HDR_LEN;
+
+	/* The TX path reads the group lists under the TX lock */
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	switch (nrf_wifi_util_tx_get_eth_type(data)) {
+	case NRF_WIFI_FMAC_ETH_P_IP:
+		if ((len < NRF_WIFI_FMAC_IPV4_MIN_HDR_LEN) ||
+		    ((ip_hdr[0] >> 4) != 4) ||
+		    (ip_hdr[9] != NRF_WIFI_FMAC_IP_PROTO_IGMP)) {
+			goto out;
+		}
+
+		ip_hdr_len = (ip_hdr[0] & 0x0F) * 4;
+		ip_len = (ip_hdr[2] << 8) | ip_hdr[3];
+
+		if (ip_len < len) {
+			len = ip_len;
+		}
+
+		if ((ip_hdr_len < NRF_WIFI_FMAC_IPV4_MIN_HDR_LEN) ||
+		    (len < ip_hdr_len)) {
+			goto out;
+		}
+
+		mc2uc_igmp_parse(vif_ctx,
+				 peer,
+				 ip_hdr + ip_hdr_len,
+				 len - ip_hdr_len);
+		break;
+	case NRF_WIFI_FMAC_ETH_P_IPV6:
+		if ((len < NRF_WIFI_FMAC_IPV6_HDR_LEN) ||
+		    ((ip_hdr[0] >> 4) != 6)) {
+			goto out;
+		}
+
+		/* MLD messages carry a router alert hop-by-hop option */
+		next_hdr = ip_hdr[6];
+		ip_hdr_len = NRF_WIFI_FMAC_IPV6_HDR_LEN;
+
+		if (next_hdr == NRF_WIFI_FMAC_IP_PROTO_HOPOPTS) {
+			if (len < ip_hdr_len + 8) {
+				goto out;
+			}
+
+			next_hdr = ip_hdr[ip_hdr_len];
+			ip_hdr_len += (ip_hdr[ip_hdr_len + 1] + 1) * 8;
+		}
+
+		if ((next_hdr != NRF_WIFI_FMAC_IP_PROTO_ICMPV6) ||
+		    (len < ip_hdr_len)) {
+			goto out;
+		}
+
+		mc2uc_mld_parse(vif_ctx,
+				peer,
+				ip_hdr + ip_hdr_len,
+				len - ip_hdr_len);
+		break;
+	default:
+		break;
+	}
+out:
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+}
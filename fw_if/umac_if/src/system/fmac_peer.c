@@ -14,6 +14,9 @@
 
 #include "host_rpu_umac_if.h"
 #include "common/fmac_util.h"
+#if defined(NRF70_DATA_TX) || defined(NRF_WIFI_TX_SHAPING)
+#include "system/fmac_tx.h"
+#endif /* NRF70_DATA_TX || NRF_WIFI_TX_SHAPING */
 
 int nrf_wifi_fmac_peer_get_id(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			      const unsigned char *mac_addr)
@@ -52,6 +55,9 @@ int nrf_wifi_fmac_peer_add(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	struct peers_info *peer;
 	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+#ifdef NRF_WIFI_TX_SHAPING
+	int ac = 0;
+#endif /* NRF_WIFI_TX_SHAPING */
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
@@ -79,6 +85,13 @@ int nrf_wifi_fmac_peer_add(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			peer->peer_id = i;
 			peer->is_legacy = is_legacy;
 			peer->qos_supported = qos_supported;
+#ifdef NRF_WIFI_TX_SHAPING
+			for (ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+				tx_shaper_init(&peer->shaper[ac],
+					       vif_ctx->tx_shaper[ac].rate_kbps,
+					       vif_ctx->tx_shaper[ac].burst_bytes);
+			}
+#endif /* NRF_WIFI_TX_SHAPING */
 			if (vif_ctx->if_type == NRF_WIFI_IFTYPE_AP) {
 				hal_rpu_mem_write(fmac_dev_ctx->hal_dev_ctx,
 						  (RPU_MEM_UMAC_PEND_Q_BMP +
@@ -129,6 +142,13 @@ void nrf_wifi_fmac_peer_remove(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			      0x0,
 			      sizeof(struct peers_info));
 	peer->peer_id = -1;
+
+#ifdef NRF70_DATA_TX
+	/* The frames still queued for the peer no longer hold its interface */
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+	tx_flow_ctrl_wake(fmac_dev_ctx);
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#endif /* NRF70_DATA_TX */
 }
 
 
@@ -167,4 +187,10 @@ void nrf_wifi_fmac_peers_flush(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			}
 		}
 	}
+
+#ifdef NRF70_DATA_TX
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+	tx_flow_ctrl_wake(fmac_dev_ctx);
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+#endif /* NRF70_DATA_TX */
 }
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief File containing sniffer filter specific definitions for the
+ * FMAC IF Layer of the Wi-Fi driver.
+ */
+
+#include "osal_api.h"
+#include "system/fmac_sniffer_filter.h"
+
+#if !defined(NRF70_RAW_DATA_RX) && !defined(NRF70_PROMISC_DATA_RX)
+#error "NRF_WIFI_SNIFFER_FILTER requires NRF70_RAW_DATA_RX or NRF70_PROMISC_DATA_RX"
+#endif
+
+#if NRF_WIFI_SNIFFER_FILTER_MAX_INSNS > 255
+#error "NRF_WIFI_SNIFFER_FILTER_MAX_INSNS must fit the compiled branch targets"
+#endif
+
+static unsigned int sniffer_filter_load(const unsigned char *data,
+					unsigned char size)
+{
+	unsigned int val = data[0];
+
+	if (size > 1) {
+		val |= data[1] << 8;
+	}
+
+	if (size > 2) {
+		val |= data[2] << 16;
+		val |= (unsigned int)data[3] << 24;
+	}
+
+	return val;
+}
+
+
+static int sniffer_filter_meta_get(unsigned short field,
+				   unsigned int len,
+				   struct raw_rx_pkt_header *raw_rx_hdr)
+{
+	switch (field) {
+	case NRF_WIFI_SNIFFER_FILTER_META_LEN:
+		return len;
+	case NRF_WIFI_SNIFFER_FILTER_META_FREQUENCY:
+		return raw_rx_hdr->frequency;
+	case NRF_WIFI_SNIFFER_FILTER_META_SIGNAL:
+		return raw_rx_hdr->signal;
+	case NRF_WIFI_SNIFFER_FILTER_META_RATE_FLAGS:
+		return raw_rx_hdr->rate_flags;
+	case NRF_WIFI_SNIFFER_FILTER_META_RATE:
+		return raw_rx_hdr->rate;
+	default:
+		return 0;
+	}
+}
+
+
+enum nrf_wifi_status nrf_wifi_fmac_sniffer_filter_compile(const struct nrf_wifi_sniffer_filter_insn *insns,
+							  unsigned int num_insns,
+							  struct nrf_wifi_sniffer_filter_insn *prog)
+{
+	const struct nrf_wifi_sniffer_filter_insn *insn = NULL;
+	unsigned int size_mask = 0;
+	unsigned int pc = 0;
+
+	if (!num_insns || num_insns > NRF_WIFI_SNIFFER_FILTER_MAX_INSNS) {
+		nrf_wifi_osal_log_err("%s: Invalid program length %d",
+				      __func__,
+				      num_insns);
+		return NRF_WIFI_STATUS_FAIL;
+	}
+
+	for (pc = 0; pc < num_insns; pc++) {
+		insn = &insns[pc];
+
+		nrf_wifi_osal_mem_cpy(&prog[pc],
+				      insn,
+				      sizeof(prog[pc]));
+
+		switch (insn->op) {
+		case NRF_WIFI_SNIFFER_FILTER_OP_ACCEPT:
+		case NRF_WIFI_SNIFFER_FILTER_OP_DROP:
+			continue;
+		case NRF_WIFI_SNIFFER_FILTER_OP_FRAME_EQ:
+		case NRF_WIFI_SNIFFER_FILTER_OP_FRAME_GT:
+			if (insn->size != 1 && insn->size != 2 && insn->size != 4) {
+				nrf_wifi_osal_log_err("%s: Invalid load size %d at %d",
+						      __func__,
+						      insn->size,
+						      pc);
+				return NRF_WIFI_STATUS_FAIL;
+			}
+
+			size_mask = (insn->size == 4) ? 0xFFFFFFFF : ((1U << (insn->size * 8)) - 1);
+			prog[pc].mask &= size_mask;
+			break;
+		case NRF_WIFI_SNIFFER_FILTER_OP_META_EQ:
+		case NRF_WIFI_SNIFFER_FILTER_OP_META_GT:
+			if (insn->offset >= NRF_WIFI_SNIFFER_FILTER_META_MAX) {
+				nrf_wifi_osal_log_err("%s: Invalid metadata field %d at %d",
+						      __func__,
+						      insn->offset,
+						      pc);
+				return NRF_WIFI_STATUS_FAIL;
+			}
+			break;
+		default:
+			nrf_wifi_osal_log_err("%s: Invalid operation %d at %d",
+					      __func__,
+					      insn->op,
+					      pc);
+			return NRF_WIFI_STATUS_FAIL;
+		}
+
+		/* An equality that can never hold is most likely a bad mask */
+		if ((insn->op == NRF_WIFI_SNIFFER_FILTER_OP_FRAME_EQ ||
+		     insn->op == NRF_WIFI_SNIFFER_FILTER_OP_META_EQ) &&
+		    (insn->value & ~prog[pc].mask)) {
+			nrf_wifi_osal_log_err("%s: Value 0x%x outside mask 0x%x at %d",
+					      __func__,
+					      insn->value,
+					      prog[pc].mask,
+					      pc);
+			return NRF_WIFI_STATUS_FAIL;
+		}
+
+		/* Branches only go forward and stay in the program, so every
+		 * path terminates on an ACCEPT or DROP within num_insns steps.
+		 */
+		if (pc + 1 + insn->jt >= num_insns ||
+		    pc + 1 + insn->jf >= num_insns) {
+			nrf_wifi_osal_log_err("%s: Branch out of program at %d",
+					      __func__,
+					      pc);
+			return NRF_WIFI_STATUS_FAIL;
+		}
+
+		prog[pc].jt = pc + 1 + insn->jt;
+		prog[pc].jf = pc + 1 + insn->jf;
+	}
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+bool nrf_wifi_fmac_sniffer_filter_match(struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+					const unsigned char *frame,
+					unsigned int len,
+					struct raw_rx_pkt_header *raw_rx_hdr)
+{
+	const struct nrf_wifi_sniffer_filter_insn *insn = NULL;
+	unsigned int pc = 0;
+	unsigned int val = 0;
+	bool cond = false;
+
+	if (!vif_ctx->sniffer_filter_len) {
+		return true;
+	}
+
+	while (pc < vif_ctx->sniffer_filter_len) {
+		insn = &vif_ctx->sniffer_filter[pc];
+
+		switch (insn->op) {
+		case NRF_WIFI_SNIFFER_FILTER_OP_ACCEPT:
+			return true;
+		case NRF_WIFI_SNIFFER_FILTER_OP_FRAME_EQ:
+		case NRF_WIFI_SNIFFER_FILTER_OP_FRAME_GT:
+			/* A field beyond the end of the frame compares false, so
+			 * programs testing optional fields still work on short frames.
+			 */
+			if (insn->offset + insn->size > len) {
+				cond = false;
+				break;
+			}
+
+			val = sniffer_filter_load(frame + insn->offset,
+						  insn->size) & insn->mask;
+
+			if (insn->op == NRF_WIFI_SNIFFER_FILTER_OP_FRAME_EQ) {
+				cond = (val == insn->value);
+			} else {
+				cond = (val > insn->value);
+			}
+			break;
+		case NRF_WIFI_SNIFFER_FILTER_OP_META_EQ:
+			val = sniffer_filter_meta_get(insn->offset,
+						      len,
+						      raw_rx_hdr);
+			cond = ((val & insn->mask) == insn->value);
+			break;
+		case NRF_WIFI_SNIFFER_FILTER_OP_META_GT:
+			cond = (sniffer_filter_meta_get(insn->offset,
+							len,
+							raw_rx_hdr) > (int)insn->value);
+			break;
+		default:
+			return false;
+		}
+
+		pc = cond ? insn->jt : insn->jf;
+	}
+
+	return false;
+}
@@ -9,10 +9,18 @@
  * FMAC IF Layer of the Wi-Fi driver.
  */
 
+#include "queue.h"
 #include "system/hal_api.h"
 #include "system/fmac_rx.h"
+#include "system/fmac_peer.h"
 #include "common/fmac_util.h"
 #include "system/fmac_promisc.h"
+#ifdef NRF_WIFI_MCAST_TO_UCAST
+#include "system/fmac_mc2uc.h"
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+#ifdef NRF_WIFI_SNIFFER_FILTER
+#include "system/fmac_sniffer_filter.h"
+#endif /* NRF_WIFI_SNIFFER_FILTER */
 
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
 #include "system/fmac_api.h"
@@ -202,6 +210,122 @@ static void nrf_wifi_convert_to_eth(void *nwb,
 		ehdr->proto = len;
 	}
 }
+
+#ifdef NRF_WIFI_LINK_STATS
+static struct nrf_wifi_fmac_link_stats_entry *rx_link_stats_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+								struct nrf_wifi_fmac_vif_ctx *vif_ctx,
+								unsigned char if_idx,
+								void *nwb)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_link_stats_entry *entry = NULL;
+	struct peers_info *peer = NULL;
+	unsigned char *src = NULL;
+	int peer_id = -1;
+	int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (vif_ctx->if_type == NRF_WIFI_IFTYPE_STATION) {
+		/* Everything received on a station interface comes from the AP */
+		for (i = 0; i < MAX_PEERS; i++) {
+			peer = &sys_dev_ctx->tx_config.peers[i];
+
+			if (peer->peer_id != -1 && peer->if_idx == if_idx) {
+				peer_id = i;
+				break;
+			}
+		}
+	} else {
+		/* Source address of the 802.3 header */
+		src = (unsigned char *)nrf_wifi_osal_nbuf_data_get(nwb) + NRF_WIFI_ETH_ADDR_LEN;
+		peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx, src);
+	}
+
+	if (peer_id < 0 || peer_id >= MAX_PEERS) {
+		return NULL;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[peer_id];
+	entry = &sys_dev_ctx->link_stats[peer_id];
+
+	/* Peer IDs are reused, start over when the slot has a new peer */
+	if (!entry->valid ||
+	    !nrf_wifi_util_ether_addr_equal(entry->mac_addr, peer->ra_addr)) {
+		nrf_wifi_osal_mem_set(entry,
+				      0,
+				      sizeof(*entry));
+		nrf_wifi_osal_mem_cpy(entry->mac_addr,
+				      peer->ra_addr,
+				      NRF_WIFI_ETH_ADDR_LEN);
+		entry->valid = true;
+	}
+
+	return entry;
+}
+
+
+static unsigned int rx_link_stats_rate_idx(unsigned char rate_flags,
+					   unsigned char rate)
+{
+	if (rate_flags != RPU_TPUT_MODE_LEGACY) {
+		return (rate < NRF_WIFI_LINK_STATS_RATES) ? rate : (NRF_WIFI_LINK_STATS_RATES - 1);
+	}
+
+	switch (rate) {
+	case 1:
+		return 0;
+	case 2:
+		return 1;
+	case 55:
+		return 2;
+	case 11:
+		return 3;
+	case 6:
+		return 4;
+	case 9:
+		return 5;
+	case 12:
+		return 6;
+	case 18:
+		return 7;
+	case 24:
+		return 8;
+	case 36:
+		return 9;
+	case 48:
+		return 10;
+	default:
+		return 11;
+	}
+}
+
+
+static void rx_link_stats_update(struct nrf_wifi_fmac_link_stats_entry *entry,
+				 struct nrf_wifi_rx_buff *config,
+				 unsigned int num_pkts)
+{
+	int signal = config->signal * NRF_WIFI_LINK_STATS_SIG_SCALE;
+
+	/* Rate and signal are reported once for all the frames of an event */
+	if (!entry->rx_pkts) {
+		entry->signal_avg = signal;
+	} else {
+		entry->signal_avg += (signal - entry->signal_avg) /
+			(1 << NRF_WIFI_LINK_STATS_SIG_AVG_SHIFT);
+	}
+
+	entry->signal_last = config->signal;
+	entry->rx_pkts += num_pkts;
+
+	if (config->rate_flags < RPU_TPUT_MODE_MAX) {
+		entry->rate_hist[config->rate_flags][rx_link_stats_rate_idx(config->rate_flags,
+									    config->rate)] += num_pkts;
+	}
+
+	entry->last_rx_ms = nrf_wifi_osal_time_get_curr_ms();
+}
+#endif /* NRF_WIFI_LINK_STATS */
 #endif /* NRF70_STA_MODE */
 
 enum nrf_wifi_status nrf_wifi_fmac_rx_cmd_send(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
@@ -335,41 +459,55 @@ out:
 
 
 #ifdef NRF70_RX_WQ_ENABLED
-void nrf_wifi_fmac_rx_tasklet(void *data)
+void nrf_wifi_fmac_rx_tasklet(unsigned long data)
 {
 	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = (struct nrf_wifi_fmac_dev_ctx *)data;
 	struct nrf_wifi_rx_buff *config = NULL;
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	enum NRF_WIFI_HAL_STATUS hal_status;
+	unsigned int budget = NRF70_RX_WQ_BUDGET;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
 	nrf_wifi_sys_hal_lock_rx(fmac_dev_ctx->hal_dev_ctx);
 	hal_status = nrf_wifi_hal_status_unlocked(fmac_dev_ctx->hal_dev_ctx);
 	if (hal_status != NRF_WIFI_HAL_STATUS_ENABLED) {
+		sys_dev_ctx->rx_tasklet_scheduled = false;
 		goto out;
 	}
 
-	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_dev_ctx->host_stats.total_rx_tasklet_runs++;
 
-	config = (struct nrf_wifi_rx_buff *)nrf_wifi_utils_q_dequeue(
-		sys_dev_ctx->rx_tasklet_event_q);
+	while (budget--) {
+		config = (struct nrf_wifi_rx_buff *)nrf_wifi_utils_q_dequeue(
+			sys_dev_ctx->rx_tasklet_event_q);
 
-	if (!config) {
-		nrf_wifi_osal_log_err("%s: No RX config available",
-					  __func__);
-		goto out;
-	}
+		if (!config) {
+			break;
+		}
 
-	status = nrf_wifi_fmac_rx_event_process(fmac_dev_ctx,
-						config);
+		status = nrf_wifi_fmac_rx_event_process(fmac_dev_ctx,
+							config);
 
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: nrf_wifi_fmac_rx_event_process failed",
-					  __func__);
-		goto out;
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: nrf_wifi_fmac_rx_event_process failed",
+					      __func__);
+		}
+
+		nrf_wifi_osal_mem_free(config);
+		sys_dev_ctx->host_stats.total_rx_tasklet_events++;
+	}
+
+	/* Budget exhausted, yield to other work and poll again later. New
+	 * RX events only get queued until the queue has been drained.
+	 */
+	if (nrf_wifi_utils_q_len(sys_dev_ctx->rx_tasklet_event_q)) {
+		nrf_wifi_osal_tasklet_schedule(sys_dev_ctx->rx_tasklet);
+	} else {
+		sys_dev_ctx->rx_tasklet_scheduled = false;
 	}
 out:
-	nrf_wifi_osal_mem_free(config);
 	nrf_wifi_sys_hal_unlock_rx(fmac_dev_ctx->hal_dev_ctx);
 }
 #endif /* NRF70_RX_WQ_ENABLED */
@@ -386,6 +524,7 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 #if defined(NRF70_PROMISC_DATA_RX)
 	unsigned short frame_control;
 #endif
+	bool sniff = false;
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
 	void *nwb = NULL;
 	void *nwb_data = NULL;
@@ -397,6 +536,10 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 	struct nrf_wifi_fmac_ieee80211_hdr hdr;
 	unsigned short eth_type = 0;
 	unsigned int size = 0;
+#ifdef NRF_WIFI_LINK_STATS
+	struct nrf_wifi_fmac_link_stats_entry *link_stats = NULL;
+	unsigned int link_pkts = 0;
+#endif /* NRF_WIFI_LINK_STATS */
 #endif /* NRF70_STA_MODE */
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
@@ -483,7 +626,16 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 				raw_rx_hdr.signal = config->signal;
 				raw_rx_hdr.rate_flags = config->rate_flags;
 				raw_rx_hdr.rate = config->rate;
-				if (nrf_wifi_util_check_filt_setting(vif_ctx, &frame_control)) {
+				sniff = nrf_wifi_util_check_filt_setting(vif_ctx, &frame_control);
+#ifdef NRF_WIFI_SNIFFER_FILTER
+				if (sniff) {
+					sniff = nrf_wifi_fmac_sniffer_filter_match(vif_ctx,
+										   nwb_data,
+										   pkt_len,
+										   &raw_rx_hdr);
+				}
+#endif /* NRF_WIFI_SNIFFER_FILTER */
+				if (sniff) {
 					sys_fpriv->callbk_fns.sniffer_callbk_fn(vif_ctx->os_vif_ctx,
 										   nwb,
 										   &raw_rx_hdr,
@@ -528,6 +680,23 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 				status = NRF_WIFI_STATUS_FAIL;
 				continue;
 			}
+#ifdef NRF_WIFI_LINK_STATS
+			if (!link_stats) {
+				link_stats = rx_link_stats_get(fmac_dev_ctx,
+							       vif_ctx,
+							       config->wdev_id,
+							       nwb);
+			}
+
+			link_pkts++;
+#endif /* NRF_WIFI_LINK_STATS */
+#ifdef NRF_WIFI_MCAST_TO_UCAST
+			if (vif_ctx->if_type == NRF_WIFI_IFTYPE_AP) {
+				nrf_wifi_fmac_mc2uc_rx_snoop(fmac_dev_ctx,
+							     vif_ctx,
+							     nwb);
+			}
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
 			sys_fpriv->callbk_fns.rx_frm_callbk_fn(vif_ctx->os_vif_ctx,
 									 nwb);
 #endif /* NRF70_STA_MODE */
@@ -550,26 +719,32 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 			raw_rx_hdr.signal = config->signal;
 			raw_rx_hdr.rate_flags = config->rate_flags;
 			raw_rx_hdr.rate = config->rate;
+			sniff = true;
 #if defined(NRF70_PROMISC_DATA_RX)
-			if (nrf_wifi_util_check_filt_setting(vif_ctx, &frame_control))
+			sniff = nrf_wifi_util_check_filt_setting(vif_ctx, &frame_control);
 #endif
-			{
+#ifdef NRF_WIFI_SNIFFER_FILTER
+			if (sniff) {
+				sniff = nrf_wifi_fmac_sniffer_filter_match(vif_ctx,
+									   nwb_data,
+									   pkt_len,
+									   &raw_rx_hdr);
+			}
+#endif /* NRF_WIFI_SNIFFER_FILTER */
+			if (sniff) {
 				sys_fpriv->callbk_fns.sniffer_callbk_fn(vif_ctx->os_vif_ctx,
 									   nwb,
 									   &raw_rx_hdr,
 									   true);
 			}
-#if defined(NRF70_PROMISC_DATA_RX)
 			/**
-			 * In the case of Monitor mode, the sniffer callback function
-			 * will free the packet. For promiscuous mode, if the packet
-			 * is not meant to be sent up the stack, the packet needs
-			 * to be freed here.
+			 * The sniffer callback function frees the packet it is
+			 * given. If the packet is not meant to be sent up the
+			 * stack, the packet needs to be freed here.
 			 */
 			else {
 				nrf_wifi_osal_nbuf_free(nwb);
 			}
-#endif
 		}
 #endif /* NRF70_RAW_DATA_RX || NRF70_PROMISC_DATA_RX */
 		else {
@@ -605,6 +780,13 @@ enum nrf_wifi_status nrf_wifi_fmac_rx_event_process(struct nrf_wifi_fmac_dev_ctx
 		}
 #endif /*NRF_WIFI_RX_BUFF_PROG_UMAC */
 	}
+#if defined(NRF70_STA_MODE) && defined(NRF_WIFI_LINK_STATS)
+	if (link_stats) {
+		rx_link_stats_update(link_stats,
+				     config,
+				     link_pkts);
+	}
+#endif /* NRF70_STA_MODE && NRF_WIFI_LINK_STATS */
 #ifdef NRF_WIFI_RX_BUFF_PROG_UMAC
 	status = nrf_wifi_fmac_prog_rx_buf_info(fmac_dev_ctx,
 												rx_buf_ipc,
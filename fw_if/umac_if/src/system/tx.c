@@ -15,10 +15,20 @@
 #include "system/fmac_tx.h"
 #include "system/fmac_api.h"
 #include "system/fmac_peer.h"
+#ifdef NRF_WIFI_MCAST_TO_UCAST
+#include "system/fmac_mc2uc.h"
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
 #include "common/hal_structs_common.h"
 #include "common/hal_mem.h"
 #include "common/fmac_util.h"
 
+#if NRF70_TX_FLOW_CTRL_HIGH_WM >= NRF70_MAX_TX_PENDING_QLEN
+#error "NRF70_TX_FLOW_CTRL_HIGH_WM must be below NRF70_MAX_TX_PENDING_QLEN"
+#endif
+#if NRF70_TX_FLOW_CTRL_LOW_WM >= NRF70_TX_FLOW_CTRL_HIGH_WM
+#error "NRF70_TX_FLOW_CTRL_LOW_WM must be below NRF70_TX_FLOW_CTRL_HIGH_WM"
+#endif
+
 static bool is_twt_emergency_pkt(void *nwb)
 {
 	unsigned char priority = nrf_wifi_osal_nbuf_get_priority(nwb);
@@ -112,6 +122,36 @@ static unsigned short get_spare_desc_q_map(struct nrf_wifi_fmac_dev_ctx *fmac_de
 }
 
 
+static int tx_desc_ac_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			  unsigned int desc)
+{
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	unsigned short spare_desc_q_map = 0;
+	int ac = 0;
+
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	/* Reserved desc */
+	if (desc < (sys_fpriv->num_tx_tokens_per_ac * NRF_WIFI_FMAC_AC_MAX)) {
+		return (desc % NRF_WIFI_FMAC_AC_MAX);
+	}
+
+	/* Derive the queue here as it is not given by UMAC. */
+	spare_desc_q_map = get_spare_desc_q_map(fmac_dev_ctx, desc);
+
+	if (spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_BK))
+		ac = NRF_WIFI_FMAC_AC_BK;
+	else if (spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_BE))
+		ac = NRF_WIFI_FMAC_AC_BE;
+	else if (spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_VI))
+		ac = NRF_WIFI_FMAC_AC_VI;
+	else if (spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_VO))
+		ac = NRF_WIFI_FMAC_AC_VO;
+
+	return ac;
+}
+
+
 static unsigned char *nrf_wifi_get_dest(void *nwb)
 {
 	return nrf_wifi_osal_nbuf_data_get(nwb);
@@ -241,6 +281,228 @@ static bool has_matching_tid(void *txq, int target_tid)
 #endif /* NRF_WIFI_QOS_NOACK_POLICY */
 
 
+#ifdef NRF70_TX_TCP_ACK_FILTER
+struct tcp_ack_info {
+	unsigned char *src_addr;
+	unsigned char *dst_addr;
+	unsigned int addr_len;
+	unsigned char *ports;
+	unsigned int ack_seq;
+	unsigned short window;
+};
+
+enum tcp_frm_type {
+	TCP_FRM_NONE,
+	TCP_FRM_SEGMENT,
+	TCP_FRM_PURE_ACK
+};
+
+struct tcp_ack_filter_info {
+	struct tcp_ack_info new_ack;
+	void *old_nwb;
+};
+
+static bool tcp_flow_match(struct tcp_ack_info *a,
+			   struct tcp_ack_info *b)
+{
+	return (a->addr_len == b->addr_len) &&
+		!nrf_wifi_osal_mem_cmp(a->src_addr, b->src_addr, a->addr_len) &&
+		!nrf_wifi_osal_mem_cmp(a->dst_addr, b->dst_addr, a->addr_len) &&
+		!nrf_wifi_osal_mem_cmp(a->ports, b->ports, 4);
+}
+
+/* Parse the TCP/IP headers of an Ethernet frame and fill in the flow
+ * information. A pure ACK carries no payload, no flags other than ACK
+ * and no options other than timestamps, so e.g. frames carrying SACK
+ * blocks or ECN echo are classified as regular segments.
+ */
+static enum tcp_frm_type tcp_frm_classify(void *nwb,
+					  struct tcp_ack_info *ack)
+{
+	unsigned char *data = NULL;
+	unsigned char *ip_hdr = NULL;
+	unsigned char *tcp_hdr = NULL;
+	unsigned int len = 0;
+	unsigned int ip_hdr_len = 0;
+	unsigned int ip_payload_len = 0;
+	unsigned int tcp_hdr_len = 0;
+	unsigned int opt = 0;
+
+	data = nrf_wifi_osal_nbuf_data_get(nwb);
+	len = nrf_wifi_osal_nbuf_data_size(nwb);
+
+	if (len < NRF_WIFI_FMAC_ETH_HDR_LEN) {
+		return TCP_FRM_NONE;
+	}
+
+	ip_hdr = data + NRF_WIFI_FMAC_ETH_HDR_LEN;
+	len -= NRF_WIFI_FMAC_ETH_HDR_LEN;
+
+	switch (nrf_wifi_util_tx_get_eth_type(data)) {
+	case NRF_WIFI_FMAC_ETH_P_IP:
+		if ((len < NRF_WIFI_FMAC_IPV4_MIN_HDR_LEN) ||
+		    ((ip_hdr[0] >> 4) != 4) ||
+		    (ip_hdr[9] != NRF_WIFI_FMAC_IP_PROTO_TCP)) {
+			return TCP_FRM_NONE;
+		}
+
+		if (((ip_hdr[6] << 8) | ip_hdr[7]) & NRF_WIFI_FMAC_IPV4_FRAG_MASK) {
+			return TCP_FRM_NONE;
+		}
+
+		ip_hdr_len = (ip_hdr[0] & 0x0F) * 4;
+		ip_payload_len = (ip_hdr[2] << 8) | ip_hdr[3];
+
+		if ((ip_hdr_len < NRF_WIFI_FMAC_IPV4_MIN_HDR_LEN) ||
+		    (ip_payload_len < ip_hdr_len)) {
+			return TCP_FRM_NONE;
+		}
+
+		ip_payload_len -= ip_hdr_len;
+		ack->src_addr = &ip_hdr[12];
+		ack->dst_addr = &ip_hdr[16];
+		ack->addr_len = 4;
+		break;
+	case NRF_WIFI_FMAC_ETH_P_IPV6:
+		/* Extension headers are not parsed */
+		if ((len < NRF_WIFI_FMAC_IPV6_HDR_LEN) ||
+		    ((ip_hdr[0] >> 4) != 6) ||
+		    (ip_hdr[6] != NRF_WIFI_FMAC_IP_PROTO_TCP)) {
+			return TCP_FRM_NONE;
+		}
+
+		ip_hdr_len = NRF_WIFI_FMAC_IPV6_HDR_LEN;
+		ip_payload_len = (ip_hdr[4] << 8) | ip_hdr[5];
+		ack->src_addr = &ip_hdr[8];
+		ack->dst_addr = &ip_hdr[24];
+		ack->addr_len = 16;
+		break;
+	default:
+		return TCP_FRM_NONE;
+	}
+
+	if (len < (ip_hdr_len + NRF_WIFI_FMAC_TCP_MIN_HDR_LEN)) {
+		return TCP_FRM_NONE;
+	}
+
+	tcp_hdr = ip_hdr + ip_hdr_len;
+	tcp_hdr_len = (tcp_hdr[12] >> 4) * 4;
+
+	if ((tcp_hdr_len < NRF_WIFI_FMAC_TCP_MIN_HDR_LEN) ||
+	    (ip_payload_len < tcp_hdr_len) ||
+	    (len < (ip_hdr_len + tcp_hdr_len))) {
+		return TCP_FRM_NONE;
+	}
+
+	ack->ports = tcp_hdr;
+	ack->ack_seq = (tcp_hdr[8] << 24) | (tcp_hdr[9] << 16) |
+		(tcp_hdr[10] << 8) | tcp_hdr[11];
+	ack->window = (tcp_hdr[14] << 8) | tcp_hdr[15];
+
+	/* No payload, only ACK set, reserved and NS bits clear */
+	if ((ip_payload_len != tcp_hdr_len) ||
+	    (tcp_hdr[13] != NRF_WIFI_FMAC_TCP_FLAG_ACK) ||
+	    (tcp_hdr[12] & 0x0F)) {
+		return TCP_FRM_SEGMENT;
+	}
+
+	opt = NRF_WIFI_FMAC_TCP_MIN_HDR_LEN;
+
+	while (opt < tcp_hdr_len) {
+		if (tcp_hdr[opt] == NRF_WIFI_FMAC_TCP_OPT_EOL) {
+			break;
+		}
+
+		if (tcp_hdr[opt] == NRF_WIFI_FMAC_TCP_OPT_NOP) {
+			opt++;
+			continue;
+		}
+
+		if ((tcp_hdr[opt] != NRF_WIFI_FMAC_TCP_OPT_TIMESTAMP) ||
+		    ((opt + NRF_WIFI_FMAC_TCP_OPT_TIMESTAMP_LEN) > tcp_hdr_len) ||
+		    (tcp_hdr[opt + 1] != NRF_WIFI_FMAC_TCP_OPT_TIMESTAMP_LEN)) {
+			return TCP_FRM_SEGMENT;
+		}
+
+		opt += NRF_WIFI_FMAC_TCP_OPT_TIMESTAMP_LEN;
+	}
+
+	return TCP_FRM_PURE_ACK;
+}
+
+
+static enum nrf_wifi_status tcp_ack_filter_callbk_fn(void *callbk_data,
+						     void *nbuf)
+{
+	struct tcp_ack_filter_info *info = NULL;
+	struct tcp_ack_info old_ack;
+	enum tcp_frm_type frm_type;
+
+	info = (struct tcp_ack_filter_info *)callbk_data;
+
+	frm_type = tcp_frm_classify(nbuf, &old_ack);
+
+	if ((frm_type == TCP_FRM_NONE) ||
+	    !tcp_flow_match(&info->new_ack, &old_ack)) {
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	/* Only the last queued frame of the flow can be superseded so that
+	 * the ACK is never moved past another segment of the same flow.
+	 * Duplicate ACKs and window updates are left intact.
+	 */
+	if ((frm_type == TCP_FRM_PURE_ACK) &&
+	    ((int)(info->new_ack.ack_seq - old_ack.ack_seq) > 0) &&
+	    (info->new_ack.window == old_ack.window)) {
+		info->old_nwb = nbuf;
+	} else {
+		info->old_nwb = NULL;
+	}
+
+	return NRF_WIFI_STATUS_SUCCESS;
+}
+
+
+static bool tx_tcp_ack_filter(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      void *queue,
+			      void *nwb)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct tcp_ack_filter_info info;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_mem_set(&info,
+			      0,
+			      sizeof(info));
+
+	if (tcp_frm_classify(nwb, &info.new_ack) != TCP_FRM_PURE_ACK) {
+		return false;
+	}
+
+	nrf_wifi_utils_list_traverse(queue,
+				     &info,
+				     tcp_ack_filter_callbk_fn);
+
+	if (!info.old_nwb) {
+		return false;
+	}
+
+	if (nrf_wifi_utils_list_replace_node(queue,
+					     info.old_nwb,
+					     nwb) != NRF_WIFI_STATUS_SUCCESS) {
+		return false;
+	}
+
+	nrf_wifi_osal_nbuf_free(info.old_nwb);
+
+	sys_dev_ctx->host_stats.total_tx_ack_suppressed_pkts++;
+
+	return true;
+}
+#endif /* NRF70_TX_TCP_ACK_FILTER */
+
+
 int pending_frames_count(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			 int peer_id)
 {
@@ -260,6 +522,146 @@ int pending_frames_count(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+static unsigned int tx_flow_ctrl_backlog(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					 unsigned char if_idx,
+					 unsigned int ac)
+{
+	unsigned int backlog = 0;
+	int peer_id = 0;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	for (peer_id = 0; peer_id < MAX_SW_PEERS; peer_id++) {
+		/* Frames left behind by a removed peer are not the stack's */
+		if (sys_dev_ctx->tx_config.peers[peer_id].peer_id == -1 ||
+		    sys_dev_ctx->tx_config.peers[peer_id].if_idx != if_idx) {
+			continue;
+		}
+
+		backlog += nrf_wifi_utils_q_len(sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac]);
+	}
+
+	return backlog;
+}
+
+
+static void tx_flow_ctrl_stop(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      unsigned char if_idx,
+			      unsigned int ac)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	unsigned char *stopped_map = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	if (!sys_fpriv->callbk_fns.stop_queue_callbk_fn || if_idx >= MAX_NUM_VIFS) {
+		return;
+	}
+
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+	stopped_map = &sys_dev_ctx->tx_config.txq_stopped_map[if_idx];
+
+	if (!vif_ctx || (*stopped_map & (1 << ac))) {
+		return;
+	}
+
+	/* Frames also pile up while tokens are free, e.g. during TWT sleep, a
+	 * client power save or shaping, so only the backlog is looked at. It
+	 * covers every queue of the interface and reaches the high watermark
+	 * before any one queue is full.
+	 */
+	if (tx_flow_ctrl_backlog(fmac_dev_ctx, if_idx, ac) < NRF70_TX_FLOW_CTRL_HIGH_WM) {
+		return;
+	}
+
+	*stopped_map |= (1 << ac);
+
+	sys_fpriv->callbk_fns.stop_queue_callbk_fn(vif_ctx->os_vif_ctx,
+						   ac);
+}
+
+
+void tx_flow_ctrl_wake(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	unsigned char *stopped_map = NULL;
+	unsigned char if_idx = 0;
+	unsigned int ac = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	for (if_idx = 0; if_idx < MAX_NUM_VIFS; if_idx++) {
+		stopped_map = &sys_dev_ctx->tx_config.txq_stopped_map[if_idx];
+
+		if (!*stopped_map) {
+			continue;
+		}
+
+		vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+
+		for (ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+			if (!(*stopped_map & (1 << ac))) {
+				continue;
+			}
+
+			if (vif_ctx &&
+			    tx_flow_ctrl_backlog(fmac_dev_ctx, if_idx, ac) >=
+			    NRF70_TX_FLOW_CTRL_LOW_WM) {
+				continue;
+			}
+
+			*stopped_map &= ~(1 << ac);
+
+			if (vif_ctx && sys_fpriv->callbk_fns.wake_queue_callbk_fn) {
+				sys_fpriv->callbk_fns.wake_queue_callbk_fn(vif_ctx->os_vif_ctx,
+									   ac);
+			}
+		}
+	}
+}
+
+
+void tx_flow_ctrl_vif_reset(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			    unsigned char if_idx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	unsigned char stopped_map = 0;
+	unsigned int ac = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	if (if_idx >= MAX_NUM_VIFS) {
+		return;
+	}
+
+	stopped_map = sys_dev_ctx->tx_config.txq_stopped_map[if_idx];
+	sys_dev_ctx->tx_config.txq_stopped_map[if_idx] = 0;
+
+	vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
+
+	if (!vif_ctx || !sys_fpriv->callbk_fns.wake_queue_callbk_fn) {
+		return;
+	}
+
+	for (ac = 0; ac < NRF_WIFI_FMAC_AC_MAX; ac++) {
+		if (stopped_map & (1 << ac)) {
+			sys_fpriv->callbk_fns.wake_queue_callbk_fn(vif_ctx->os_vif_ctx,
+								   ac);
+		}
+	}
+}
+
+
 static enum nrf_wifi_status update_pend_q_bmp(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				       unsigned int ac,
 				       int peer_id)
@@ -515,6 +917,174 @@ static int get_peer_from_wakeup_q(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+#ifdef NRF_WIFI_TX_SHAPING
+void tx_shaper_init(struct nrf_wifi_tx_shaper *shaper,
+		    unsigned int rate_kbps,
+		    unsigned int burst_bytes)
+{
+	shaper->rate_kbps = rate_kbps;
+	shaper->burst_bytes = burst_bytes;
+	shaper->tokens = burst_bytes;
+	shaper->last_refill_us = nrf_wifi_osal_time_get_curr_us();
+}
+
+
+static void tx_shaper_refill(struct nrf_wifi_tx_shaper *shaper,
+			     unsigned long now_us)
+{
+	unsigned long long credit = 0;
+
+	/* 1 kbps earns a byte every 8000 us */
+	credit = ((unsigned long long)(now_us - shaper->last_refill_us) *
+		  shaper->rate_kbps) / 8000;
+
+	if (shaper->tokens + (long long)credit >= shaper->burst_bytes) {
+		shaper->tokens = shaper->burst_bytes;
+		shaper->last_refill_us = now_us;
+		return;
+	}
+
+	shaper->tokens += credit;
+
+	/* Keep the time spent earning a partial byte for the next refill */
+	shaper->last_refill_us += (unsigned long)((credit * 8000) / shaper->rate_kbps);
+}
+
+
+/* Time in ms until the queue may send again, 0 if it may send now */
+static unsigned int tx_shaper_wait_ms(struct nrf_wifi_tx_shaper *shaper,
+				      unsigned long now_us)
+{
+	unsigned long long wait_us = 0;
+
+	if (!shaper->rate_kbps) {
+		return 0;
+	}
+
+	tx_shaper_refill(shaper,
+			 now_us);
+
+	if (shaper->tokens > 0) {
+		return 0;
+	}
+
+	wait_us = ((unsigned long long)(1 - shaper->tokens) * 8000) / shaper->rate_kbps;
+
+	return (unsigned int)(wait_us / 1000) + 1;
+}
+
+
+static void tx_shaper_limit_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				int peer_id,
+				unsigned int ac,
+				int *max_bytes)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_tx_shaper *shaper = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (peer_id < 0 || peer_id >= MAX_PEERS) {
+		return;
+	}
+
+	shaper = &sys_dev_ctx->tx_config.peers[peer_id].shaper[ac];
+
+	if (!shaper->rate_kbps) {
+		return;
+	}
+
+	/* Without tokens only the single frame which is always sent goes */
+	if (shaper->tokens < *max_bytes) {
+		*max_bytes = (shaper->tokens > 0) ? shaper->tokens : 0;
+	}
+}
+
+
+static void tx_shaper_charge(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			     int peer_id,
+			     unsigned int ac,
+			     unsigned int bytes)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_tx_shaper *shaper = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (peer_id < 0 || peer_id >= MAX_PEERS) {
+		return;
+	}
+
+	shaper = &sys_dev_ctx->tx_config.peers[peer_id].shaper[ac];
+
+	if (shaper->rate_kbps) {
+		shaper->tokens -= bytes;
+	}
+}
+
+
+static void tx_shaper_timer_arm(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				unsigned int wait_ms)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (sys_dev_ctx->tx_config.shaper_timer_armed) {
+		return;
+	}
+
+	sys_dev_ctx->tx_config.shaper_timer_armed = true;
+
+	nrf_wifi_osal_timer_schedule(sys_dev_ctx->tx_config.shaper_timer,
+				     wait_ms);
+}
+
+
+void tx_shaper_kick(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	unsigned int desc = 0;
+	int ac = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	/* The TWT wake up restarts the pending queues */
+	if (sys_dev_ctx->twt_sleep_status != NRF_WIFI_FMAC_TWT_STATE_AWAKE) {
+		return;
+	}
+
+	for (ac = NRF_WIFI_FMAC_AC_VO; ac >= 0; --ac) {
+		desc = tx_desc_get(fmac_dev_ctx, ac);
+
+		if (desc < sys_fpriv->num_tx_tokens) {
+			tx_pending_process(fmac_dev_ctx, desc, ac);
+		}
+	}
+}
+
+
+static void tx_shaper_timer_fn(unsigned long data)
+{
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = (struct nrf_wifi_fmac_dev_ctx *)data;
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	sys_dev_ctx->tx_config.shaper_timer_armed = false;
+
+	tx_shaper_kick(fmac_dev_ctx);
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+}
+#endif /* NRF_WIFI_TX_SHAPING */
+
+
 static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			 unsigned int ac)
 {
@@ -526,6 +1096,11 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	int peer_id = -1;
 	unsigned char ps_state = 0;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+#ifdef NRF_WIFI_TX_SHAPING
+	unsigned long now_us = 0;
+	unsigned int wait_ms = 0;
+	unsigned int min_wait_ms = 0;
+#endif /* NRF_WIFI_TX_SHAPING */
 
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
@@ -539,33 +1114,120 @@ static int tx_curr_peer_opp_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		return peer_id;
 	}
 
-	init_peer_opp = sys_dev_ctx->tx_config.curr_peer_opp[ac];
+	init_peer_opp = sys_dev_ctx->tx_config.curr_peer_opp[ac];
+
+#ifdef NRF_WIFI_TX_SHAPING
+	now_us = nrf_wifi_osal_time_get_curr_us();
+#endif /* NRF_WIFI_TX_SHAPING */
+
+	for (i = 0; i < MAX_PEERS; i++) {
+		curr_peer_opp = (init_peer_opp + i) % MAX_PEERS;
+
+		ps_state = sys_dev_ctx->tx_config.peers[curr_peer_opp].ps_state;
+
+		if (ps_state == NRF_WIFI_CLIENT_PS_MODE) {
+			continue;
+		}
+
+		pend_q = sys_dev_ctx->tx_config.data_pending_txq[curr_peer_opp][ac];
+		pend_q_len = nrf_wifi_utils_q_len(pend_q);
+
+		if (pend_q_len) {
+#ifdef NRF_WIFI_TX_SHAPING
+			/* Skip the peer without taking a TX descriptor, the
+			 * timer restarts TX once its bucket has refilled.
+			 */
+			wait_ms = tx_shaper_wait_ms(&sys_dev_ctx->tx_config.peers[curr_peer_opp].shaper[ac],
+						    now_us);
+
+			if (wait_ms) {
+				if (!min_wait_ms || wait_ms < min_wait_ms) {
+					min_wait_ms = wait_ms;
+				}
+				continue;
+			}
+#endif /* NRF_WIFI_TX_SHAPING */
+			sys_dev_ctx->tx_config.curr_peer_opp[ac] =
+				(curr_peer_opp + 1) % MAX_PEERS;
+			break;
+		}
+	}
+
+	if (i != MAX_PEERS) {
+		peer_id = curr_peer_opp;
+	}
+#ifdef NRF_WIFI_TX_SHAPING
+	else if (min_wait_ms) {
+		tx_shaper_timer_arm(fmac_dev_ctx,
+				    min_wait_ms);
+	}
+#endif /* NRF_WIFI_TX_SHAPING */
+
+	return peer_id;
+}
+
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+static bool tx_aggr_contended(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			      int peer_id,
+			      unsigned int ac)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	void *pend_q = NULL;
+	int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	for (i = 0; i < MAX_PEERS; i++) {
+		if (i == peer_id ||
+		    sys_dev_ctx->tx_config.peers[i].ps_state == NRF_WIFI_CLIENT_PS_MODE) {
+			continue;
+		}
+
+		pend_q = sys_dev_ctx->tx_config.data_pending_txq[i][ac];
+
+		if (nrf_wifi_utils_q_len(pend_q)) {
+			return true;
+		}
+	}
+
+	return false;
+}
 
-	for (i = 0; i < MAX_PEERS; i++) {
-		curr_peer_opp = (init_peer_opp + i) % MAX_PEERS;
 
-		ps_state = sys_dev_ctx->tx_config.peers[curr_peer_opp].ps_state;
+static void tx_aggr_limits_get(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			       int peer_id,
+			       unsigned int ac,
+			       int *max_frames,
+			       int *max_bytes)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_tx_aggr_ctrl *ctrl = NULL;
 
-		if (ps_state == NRF_WIFI_CLIENT_PS_MODE) {
-			continue;
-		}
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
-		pend_q = sys_dev_ctx->tx_config.data_pending_txq[curr_peer_opp][ac];
-		pend_q_len = nrf_wifi_utils_q_len(pend_q);
+	if (peer_id < 0 || peer_id >= MAX_PEERS) {
+		return;
+	}
 
-		if (pend_q_len) {
-			sys_dev_ctx->tx_config.curr_peer_opp[ac] =
-				(curr_peer_opp + 1) % MAX_PEERS;
-			break;
-		}
+	ctrl = &sys_dev_ctx->tx_config.peers[peer_id].aggr_ctrl[ac];
+
+	/* No TX done feedback yet */
+	if (!ctrl->max_frames) {
+		return;
 	}
 
-	if (i != MAX_PEERS) {
-		peer_id = curr_peer_opp;
+	if ((int)ctrl->max_frames < *max_frames) {
+		*max_frames = ctrl->max_frames;
 	}
 
-	return peer_id;
+	/* A long token only costs airtime when other peers are waiting */
+	if (ctrl->rate_bpms &&
+	    (int)ctrl->max_bytes < *max_bytes &&
+	    tx_aggr_contended(fmac_dev_ctx, peer_id, ac)) {
+		*max_bytes = ctrl->max_bytes;
+	}
 }
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
 
 static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 			unsigned int desc,
@@ -581,6 +1243,12 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 	int max_txq_len, avail_ampdu_len_per_token;
 	int ampdu_len = 0;
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+	int aggr_bytes = 0;
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+#ifdef NRF_WIFI_TX_SHAPING
+	unsigned int shaped_bytes = 0;
+#endif /* NRF_WIFI_TX_SHAPING */
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
 
@@ -613,6 +1281,20 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		return 0;
 	}
 
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+	tx_aggr_limits_get(fmac_dev_ctx,
+			   peer_id,
+			   ac,
+			   &max_txq_len,
+			   &avail_ampdu_len_per_token);
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+#ifdef NRF_WIFI_TX_SHAPING
+	tx_shaper_limit_get(fmac_dev_ctx,
+			    peer_id,
+			    ac,
+			    &avail_ampdu_len_per_token);
+#endif /* NRF_WIFI_TX_SHAPING */
+
 	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
 	txq = pkt_info->pkt;
 
@@ -643,6 +1325,12 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 		nrf_wifi_utils_list_add_tail(txq,
 					     nwb);
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+		aggr_bytes = ampdu_len;
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+#ifdef NRF_WIFI_TX_SHAPING
+		shaped_bytes += nrf_wifi_osal_nbuf_data_size(nwb);
+#endif /* NRF_WIFI_TX_SHAPING */
 	}
 
 	/* If our criterion rejects all pending frames, or
@@ -659,12 +1347,28 @@ static size_t _tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 
 		nrf_wifi_utils_list_add_tail(txq,
 					     nwb);
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+		aggr_bytes = TX_BUF_HEADROOM +
+			nrf_wifi_osal_nbuf_data_size((void *)nwb);
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+#ifdef NRF_WIFI_TX_SHAPING
+		shaped_bytes = nrf_wifi_osal_nbuf_data_size(nwb);
+#endif /* NRF_WIFI_TX_SHAPING */
 	}
 
 	len = nrf_wifi_utils_q_len(txq);
 
 	if (len > 0) {
 		sys_dev_ctx->tx_config.pkt_info_p[desc].peer_id = peer_id;
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+		pkt_info->aggr_bytes = aggr_bytes;
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+#ifdef NRF_WIFI_TX_SHAPING
+		tx_shaper_charge(fmac_dev_ctx,
+				 peer_id,
+				 ac,
+				 shaped_bytes);
+#endif /* NRF_WIFI_TX_SHAPING */
 	}
 
 	update_pend_q_bmp(fmac_dev_ctx, ac, peer_id);
@@ -877,6 +1581,15 @@ enum nrf_wifi_status rawtx_cmd_prepare(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ct
 		goto err;
 	}
 
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+	status = nrf_wifi_sys_hal_buf_map_tx_flush(fmac_dev_ctx->hal_dev_ctx);
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: nrf_wifi_sys_hal_buf_map_tx_flush failed",
+				      __func__);
+		goto err;
+	}
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
+
 	return NRF_WIFI_STATUS_SUCCESS;
 err:
 	return NRF_WIFI_STATUS_FAIL;
@@ -920,6 +1633,9 @@ static enum nrf_wifi_status tx_cmd_prepare(struct nrf_wifi_fmac_dev_ctx *fmac_de
 	nwb = nrf_wifi_utils_list_peek(txq);
 
 	sys_dev_ctx->tx_config.send_pkt_coalesce_count_p[desc] = txq_len;
+#ifdef NRF_WIFI_TX_LATENCY_STATS
+	sys_dev_ctx->tx_config.pkt_info_p[desc].tx_start_us = nrf_wifi_osal_time_get_curr_us();
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
 
 	config = (struct nrf_wifi_tx_buff *)(umac_cmd->msg);
 
@@ -978,6 +1694,16 @@ static enum nrf_wifi_status tx_cmd_prepare(struct nrf_wifi_fmac_dev_ctx *fmac_de
 		goto err;
 	}
 
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+	status = nrf_wifi_sys_hal_buf_map_tx_flush(fmac_dev_ctx->hal_dev_ctx);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: nrf_wifi_sys_hal_buf_map_tx_flush failed",
+				      __func__);
+		goto err;
+	}
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
+
 	sys_dev_ctx->host_stats.total_tx_pkts += config->num_tx_pkts;
 	config->wdev_id = sys_dev_ctx->tx_config.peers[peer_id].if_idx;
 
@@ -1054,6 +1780,38 @@ out:
 }
 #endif /* NRF70_RAW_DATA_TX */
 
+static enum nrf_wifi_status tx_cmd_send(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					struct host_rpu_msg *umac_cmd,
+					unsigned int len,
+					void *txq,
+					int desc)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	void *nwb = NULL;
+
+	status = nrf_wifi_sys_hal_data_cmd_send(fmac_dev_ctx->hal_dev_ctx,
+						NRF_WIFI_HAL_MSG_TYPE_CMD_DATA_TX,
+						umac_cmd,
+						sizeof(*umac_cmd) + len,
+						desc,
+						0);
+
+	nrf_wifi_osal_mem_free(umac_cmd);
+
+	while (nrf_wifi_utils_q_len(txq)) {
+		nwb = nrf_wifi_utils_q_dequeue(txq);
+
+		if (!nwb) {
+			continue;
+		}
+
+		nrf_wifi_osal_nbuf_free(nwb);
+	}
+
+	return status;
+}
+
+
 enum nrf_wifi_status tx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 				 void *txq,
 				 int desc,
@@ -1062,7 +1820,6 @@ enum nrf_wifi_status tx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct host_rpu_msg *umac_cmd = NULL;
 	unsigned int len = 0;
-	void *nwb = NULL;
 
 	len += sizeof(struct nrf_wifi_tx_buff_info);
 	len *= nrf_wifi_utils_list_len(txq);
@@ -1086,24 +1843,11 @@ enum nrf_wifi_status tx_cmd_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 		goto out;
 	}
 
-	status = nrf_wifi_sys_hal_data_cmd_send(fmac_dev_ctx->hal_dev_ctx,
-						NRF_WIFI_HAL_MSG_TYPE_CMD_DATA_TX,
-						umac_cmd,
-						sizeof(*umac_cmd) + len,
-						desc,
-						0);
-
-	nrf_wifi_osal_mem_free(umac_cmd);
-
-	while (nrf_wifi_utils_q_len(txq)) {
-		nwb = nrf_wifi_utils_q_dequeue(txq);
-
-		if (!nwb) {
-			continue;
-		}
-
-		nrf_wifi_osal_nbuf_free(nwb);
-	}
+	status = tx_cmd_send(fmac_dev_ctx,
+			     umac_cmd,
+			     len,
+			     txq,
+			     desc);
 out:
 	return status;
 }
@@ -1152,12 +1896,310 @@ enum nrf_wifi_status tx_pending_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_c
 			     desc,
 			     ac);
 
-		status = NRF_WIFI_STATUS_SUCCESS;
+		status = NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	tx_flow_ctrl_wake(fmac_dev_ctx);
+out:
+	return status;
+}
+
+
+#ifdef NRF_WIFI_TWT_PRESTAGE
+static enum nrf_wifi_status tx_twt_stage(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+					 unsigned int desc)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	struct host_rpu_msg *umac_cmd = NULL;
+	unsigned int len = 0;
+	void *nwb = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+	if (pkt_info->twt_staged_cmd) {
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+
+	nwb = nrf_wifi_utils_list_peek(pkt_info->pkt);
+
+	if (!nwb) {
+		nrf_wifi_osal_log_err("%s: No pending packets in txq",
+				      __func__);
+		goto out;
+	}
+
+#ifdef NRF70_RAW_DATA_TX
+	/* Raw frames go through the control path, send them on wake up */
+	if (nrf_wifi_osal_nbuf_is_raw_tx(nwb)) {
+		status = NRF_WIFI_STATUS_SUCCESS;
+		goto out;
+	}
+#endif /* NRF70_RAW_DATA_TX */
+
+	len += sizeof(struct nrf_wifi_tx_buff_info);
+	len *= nrf_wifi_utils_list_len(pkt_info->pkt);
+
+	len += sizeof(struct nrf_wifi_tx_buff);
+
+	umac_cmd = umac_cmd_alloc(fmac_dev_ctx,
+				  NRF_WIFI_HOST_RPU_MSG_TYPE_DATA,
+				  len);
+
+	if (!umac_cmd) {
+		goto out;
+	}
+
+	status = tx_cmd_prepare(fmac_dev_ctx,
+				umac_cmd,
+				desc,
+				pkt_info->pkt,
+				pkt_info->peer_id);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: tx_cmd_prepare failed",
+				      __func__);
+		nrf_wifi_osal_mem_free(umac_cmd);
+		goto out;
+	}
+
+	pkt_info->twt_staged_cmd = umac_cmd;
+	pkt_info->twt_staged_len = len;
+out:
+	return status;
+}
+
+
+/* Build the TX commands for everything queued while asleep, highest AC
+ * first, so that the frames are already in RPU memory when the service
+ * period starts.
+ */
+static void tx_twt_prestage(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	unsigned int desc = 0;
+	int ac = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	/* Tokens which completed while asleep already hold their next frames */
+	for (desc = 0; desc < sys_fpriv->num_tx_tokens; desc++) {
+		pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+		if (pkt_info->twt_held) {
+			tx_twt_stage(fmac_dev_ctx, desc);
+		}
+	}
+
+	for (ac = NRF_WIFI_FMAC_AC_MC; ac >= NRF_WIFI_FMAC_AC_BK; --ac) {
+		while (1) {
+			desc = tx_desc_get(fmac_dev_ctx, ac);
+
+			if (desc == sys_fpriv->num_tx_tokens) {
+				break;
+			}
+
+			if (!_tx_pending_process(fmac_dev_ctx, desc, ac)) {
+				tx_desc_free(fmac_dev_ctx,
+					     desc,
+					     ac);
+				break;
+			}
+
+			pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+			pkt_info->twt_ac = ac;
+			pkt_info->twt_held = true;
+
+			if (tx_twt_stage(fmac_dev_ctx, desc) != NRF_WIFI_STATUS_SUCCESS) {
+				break;
+			}
+		}
+	}
+
+	tx_flow_ctrl_wake(fmac_dev_ctx);
+}
+
+
+/* Post the held tokens, highest AC first. Staged commands only need to be
+ * handed to the RPU, the rest are built now.
+ */
+static void tx_twt_staged_post(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	struct host_rpu_msg *umac_cmd = NULL;
+	unsigned int desc = 0;
+	int ac = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	for (ac = NRF_WIFI_FMAC_AC_MC; ac >= NRF_WIFI_FMAC_AC_BK; --ac) {
+		for (desc = 0; desc < sys_fpriv->num_tx_tokens; desc++) {
+			pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+			if (!pkt_info->twt_held || pkt_info->twt_ac != ac) {
+				continue;
+			}
+
+			pkt_info->twt_held = false;
+			umac_cmd = pkt_info->twt_staged_cmd;
+			pkt_info->twt_staged_cmd = NULL;
+
+			if (umac_cmd) {
+#ifdef NRF_WIFI_TX_LATENCY_STATS
+				/* Time held for the TWT wake is not TX latency */
+				pkt_info->tx_start_us = nrf_wifi_osal_time_get_curr_us();
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+				tx_cmd_send(fmac_dev_ctx,
+					    umac_cmd,
+					    pkt_info->twt_staged_len,
+					    pkt_info->pkt,
+					    desc);
+				continue;
+			}
+
+#ifdef NRF70_RAW_DATA_TX
+			if (nrf_wifi_osal_nbuf_is_raw_tx(nrf_wifi_utils_list_peek(pkt_info->pkt))) {
+				rawtx_cmd_init(fmac_dev_ctx,
+					       pkt_info->pkt,
+					       desc,
+					       pkt_info->peer_id);
+				continue;
+			}
+#endif /* NRF70_RAW_DATA_TX */
+			tx_cmd_init(fmac_dev_ctx,
+				    pkt_info->pkt,
+				    desc,
+				    pkt_info->peer_id);
+		}
+	}
+}
+
+
+static void tx_twt_prestage_timer_fn(unsigned long data)
+{
+	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	fmac_dev_ctx = (struct nrf_wifi_fmac_dev_ctx *)data;
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	/* The timer may have fired just before a wake up, the sleep status
+	 * is only updated by the OS layer once that has been handled.
+	 */
+	if (sys_dev_ctx->tx_config.twt_prestage_allowed) {
+		tx_twt_prestage(fmac_dev_ctx);
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+}
+
+
+static void tx_twt_prestage_timer_arm(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	unsigned int interval_us = 0;
+	unsigned int wait_us = 0;
+	unsigned int lead_us = NRF_WIFI_TWT_PRESTAGE_LEAD_MS * 1000;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	interval_us = sys_dev_ctx->tx_config.twt_wake_interval_us;
+
+	/* No agreement, or no service period seen yet to predict from */
+	if (!interval_us || !sys_dev_ctx->tx_config.twt_sp_start_us) {
+		return;
+	}
+
+	/* Service periods start every wake interval after the last one */
+	wait_us = interval_us -
+		(nrf_wifi_osal_time_elapsed_us(sys_dev_ctx->tx_config.twt_sp_start_us) %
+		 interval_us);
+
+	if (wait_us > lead_us + 1000) {
+		wait_us -= lead_us;
+	} else {
+		wait_us = 1000;
+	}
+
+	nrf_wifi_osal_timer_schedule(sys_dev_ctx->tx_config.twt_prestage_timer,
+				     wait_us / 1000);
+}
+
+
+void tx_twt_params_set(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+		       struct nrf_wifi_umac_config_twt_info *twt_info)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	unsigned long long interval_us = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (twt_info &&
+	    twt_info->setup_cmd == NRF_WIFI_ACCEPT_TWT &&
+	    twt_info->twt_target_wake_interval_exponent < 32) {
+		interval_us = (unsigned long long)twt_info->twt_target_wake_interval_mantissa <<
+			twt_info->twt_target_wake_interval_exponent;
+	}
+
+	/* Intervals beyond the range of the elapsed time are not predicted */
+	if (interval_us > 0xFFFFFFFF) {
+		interval_us = 0;
+	}
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	sys_dev_ctx->tx_config.twt_wake_interval_us = (unsigned int)interval_us;
+	sys_dev_ctx->tx_config.twt_sp_start_us = 0;
+
+	/* Without an agreement there is no service period to wait for */
+	if (!interval_us) {
+		sys_dev_ctx->tx_config.twt_prestage_allowed = false;
+		tx_twt_staged_post(fmac_dev_ctx);
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	if (!interval_us) {
+		nrf_wifi_osal_timer_kill(sys_dev_ctx->tx_config.twt_prestage_timer);
 	}
+}
 
-out:
-	return status;
+
+void tx_twt_sleep_update(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+			 unsigned int type)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	if (type == TWT_UNBLOCK_TX) {
+		nrf_wifi_osal_timer_kill(sys_dev_ctx->tx_config.twt_prestage_timer);
+	}
+
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	if (type == TWT_UNBLOCK_TX) {
+		sys_dev_ctx->tx_config.twt_prestage_allowed = false;
+		sys_dev_ctx->tx_config.twt_sp_start_us = nrf_wifi_osal_time_get_curr_us();
+		tx_twt_staged_post(fmac_dev_ctx);
+	} else {
+		sys_dev_ctx->tx_config.twt_prestage_allowed = true;
+		tx_twt_prestage_timer_arm(fmac_dev_ctx);
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
 }
+#endif /* NRF_WIFI_TWT_PRESTAGE */
 
 
 static enum nrf_wifi_status tx_enqueue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
@@ -1180,9 +2222,18 @@ static enum nrf_wifi_status tx_enqueue(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ct
 
 	queue = sys_dev_ctx->tx_config.data_pending_txq[peer_id][ac];
 
+#ifdef NRF70_TX_TCP_ACK_FILTER
+	if (!is_twt_emergency_pkt(nwb) &&
+	    tx_tcp_ack_filter(fmac_dev_ctx, queue, nwb)) {
+		status = NRF_WIFI_STATUS_SUCCESS;
+		goto out;
+	}
+#endif /* NRF70_TX_TCP_ACK_FILTER */
+
 	qlen = nrf_wifi_utils_q_len(queue);
 
 	if (qlen >= NRF70_MAX_TX_PENDING_QLEN) {
+		sys_dev_ctx->host_stats.total_tx_drop_pkts++;
 		goto out;
 	}
 
@@ -1285,7 +2336,6 @@ unsigned int tx_buff_req_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	unsigned int pkts_pend = 0;
 	unsigned int desc = tx_desc_num;
 	int tx_done_q = 0, start_ac, end_ac, cnt = 0;
-	unsigned short tx_done_spare_desc_q_map = 0;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
 	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
 
@@ -1293,25 +2343,12 @@ unsigned int tx_buff_req_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
 
 	/* Determine the Queue from the descriptor */
+	tx_done_q = tx_desc_ac_get(fmac_dev_ctx, desc);
+
 	/* Reserved desc */
 	if (desc < (sys_fpriv->num_tx_tokens_per_ac * NRF_WIFI_FMAC_AC_MAX)) {
-		tx_done_q = (desc % NRF_WIFI_FMAC_AC_MAX);
 		start_ac = end_ac = tx_done_q;
 	} else {
-		/* Derive the queue here as it is not given by UMAC. */
-		if (desc >= (sys_fpriv->num_tx_tokens_per_ac * NRF_WIFI_FMAC_AC_MAX)) {
-			tx_done_spare_desc_q_map = get_spare_desc_q_map(fmac_dev_ctx, desc);
-
-			if (tx_done_spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_BK))
-				tx_done_q = NRF_WIFI_FMAC_AC_BK;
-			else if (tx_done_spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_BE))
-				tx_done_q = NRF_WIFI_FMAC_AC_BE;
-			else if (tx_done_spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_VI))
-				tx_done_q = NRF_WIFI_FMAC_AC_VI;
-			else if (tx_done_spare_desc_q_map & (1 << NRF_WIFI_FMAC_AC_VO))
-				tx_done_q = NRF_WIFI_FMAC_AC_VO;
-		}
-
 		/* Spare desc:
 		 * Loop through all AC's
 		 */
@@ -1352,8 +2389,303 @@ unsigned int tx_buff_req_free(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
 }
 
 
+#if defined(NRF_WIFI_TX_STATUS_REPORT) || defined(NRF_WIFI_TX_AMPDU_ADAPT)
+/* Number of status codes actually carried by the event, the count reported
+ * by the RPU is not trusted beyond the event length and the aggregate size.
+ */
+static unsigned int tx_done_num_status_get(struct nrf_wifi_tx_buff_done *config)
+{
+	unsigned int num_tx_status_code = config->num_tx_status_code;
+	unsigned int event_len = config->umac_head.len;
+
+	if (event_len < sizeof(*config)) {
+		return 0;
+	}
+
+	if (num_tx_status_code > event_len - sizeof(*config)) {
+		num_tx_status_code = event_len - sizeof(*config);
+	}
+
+	if (num_tx_status_code > MAX_TX_AGG_SIZE) {
+		num_tx_status_code = MAX_TX_AGG_SIZE;
+	}
+
+	return num_tx_status_code;
+}
+#endif /* NRF_WIFI_TX_STATUS_REPORT || NRF_WIFI_TX_AMPDU_ADAPT */
+
+
+#ifdef NRF_WIFI_TX_STATUS_REPORT
+static void tx_done_status_report(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				  unsigned int desc,
+				  const unsigned char *tx_status_code,
+				  unsigned int num_tx_status_code)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_fmac_vif_ctx *vif_ctx = NULL;
+	struct peers_info *peer = NULL;
+	unsigned int num_frames = 0;
+	unsigned int frame = 0;
+	int peer_id = 0;
+	int ac = 0;
+	bool success = false;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+
+	peer_id = sys_dev_ctx->tx_config.pkt_info_p[desc].peer_id;
+
+	if (peer_id < 0 || peer_id >= MAX_SW_PEERS) {
+		return;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[peer_id];
+
+	/* Peer got removed while the frames were in flight */
+	if (peer->peer_id != peer_id) {
+		return;
+	}
+
+	ac = tx_desc_ac_get(fmac_dev_ctx, desc);
+	vif_ctx = sys_dev_ctx->vif_ctx[peer->if_idx];
+
+	/* Status codes are in the order the frames were queued to the RPU */
+	num_frames = sys_dev_ctx->tx_config.send_pkt_coalesce_count_p[desc];
+
+	if (num_tx_status_code < num_frames) {
+		num_frames = num_tx_status_code;
+	}
+
+	for (frame = 0; frame < num_frames; frame++) {
+		success = (tx_status_code[frame] == NRF_WIFI_TX_STATUS_SUCCESS);
+
+		if (success) {
+			peer->tx_ok[ac]++;
+		} else {
+			peer->tx_fail[ac]++;
+		}
+
+		if (vif_ctx && sys_fpriv->callbk_fns.tx_frm_status_callbk_fn) {
+			sys_fpriv->callbk_fns.tx_frm_status_callbk_fn(vif_ctx->os_vif_ctx,
+								     peer->ra_addr,
+								     ac,
+								     frame,
+								     success);
+		}
+	}
+}
+#endif /* NRF_WIFI_TX_STATUS_REPORT */
+
+
+#if defined(NRF_WIFI_TX_LATENCY_STATS) || defined(NRF_WIFI_TX_AMPDU_ADAPT)
+static unsigned long long tx_done_phy_ts_get(const unsigned char *ts)
+{
+	unsigned long long val = 0;
+	int i = 0;
+
+	for (i = 5; i >= 0; i--) {
+		val = (val << 8) | ts[i];
+	}
+
+	return val;
+}
+
+
+static unsigned int tx_done_air_us_get(struct nrf_wifi_tx_buff_done *config)
+{
+	unsigned long long t1 = 0;
+	unsigned long long t4 = 0;
+
+	t1 = tx_done_phy_ts_get(config->timestamp_t1);
+	t4 = tx_done_phy_ts_get(config->timestamp_t4);
+
+	/* No ACK (or no timestamps from this FW) */
+	if (!t1 || !t4) {
+		return 0;
+	}
+
+	/* The PHY timer is 48 bits wide, modulo arithmetic handles the wrap */
+	return (unsigned int)(((t4 - t1) & 0xFFFFFFFFFFFFULL) /
+			      NRF_WIFI_TX_LATENCY_PHY_TICKS_PER_US);
+}
+#endif /* NRF_WIFI_TX_LATENCY_STATS || NRF_WIFI_TX_AMPDU_ADAPT */
+
+
+#ifdef NRF_WIFI_TX_LATENCY_STATS
+static void tx_latency_hist_add(struct nrf_wifi_tx_latency_hist *hist,
+				unsigned int latency_us)
+{
+	unsigned int bucket = 0;
+
+	while (bucket < NRF_WIFI_TX_LATENCY_BUCKETS - 1 &&
+	       (latency_us >> bucket)) {
+		bucket++;
+	}
+
+	hist->buckets[bucket]++;
+	hist->num_samples++;
+
+	if (latency_us > hist->max_us) {
+		hist->max_us = latency_us;
+	}
+}
+
+
+static void tx_done_latency_record(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				   unsigned int desc,
+				   struct nrf_wifi_tx_buff_done *config)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_tx_latency_hist *hist = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	struct peers_info *peer = NULL;
+	unsigned int total_us = 0;
+	unsigned int air_us = 0;
+	int ac = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+	if (pkt_info->peer_id >= MAX_SW_PEERS) {
+		return;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[pkt_info->peer_id];
+
+	if (peer->peer_id != (int)pkt_info->peer_id) {
+		return;
+	}
+
+	ac = tx_desc_ac_get(fmac_dev_ctx, desc);
+	hist = peer->tx_latency[ac];
+
+	total_us = nrf_wifi_osal_time_elapsed_us(pkt_info->tx_start_us);
+
+	tx_latency_hist_add(&hist[NRF_WIFI_TX_LATENCY_SEG_TOTAL],
+			    total_us);
+
+	air_us = tx_done_air_us_get(config);
+
+	/* Without the PHY timestamps only the total is known */
+	if (!air_us) {
+		return;
+	}
+
+	/* The PHY and host clocks are not synchronized, so the firmware
+	 * segment is what remains of the host observed total.
+	 */
+	if (air_us > total_us) {
+		air_us = total_us;
+	}
+
+	tx_latency_hist_add(&hist[NRF_WIFI_TX_LATENCY_SEG_AIR],
+			    air_us);
+	tx_latency_hist_add(&hist[NRF_WIFI_TX_LATENCY_SEG_FW],
+			    total_us - air_us);
+}
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+
+
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+static void tx_aggr_ctrl_update(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+				unsigned int desc,
+				struct nrf_wifi_tx_buff_done *config)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_sys_fmac_priv *sys_fpriv = NULL;
+	struct nrf_wifi_tx_aggr_ctrl *ctrl = NULL;
+	struct tx_pkt_info *pkt_info = NULL;
+	struct peers_info *peer = NULL;
+	unsigned int num_frames = 0;
+	unsigned int num_failed = 0;
+	unsigned int num_status = 0;
+	unsigned int frame = 0;
+	unsigned int air_us = 0;
+	unsigned int rate_bpms = 0;
+	unsigned int max_bytes = 0;
+	int ac = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	sys_fpriv = wifi_fmac_priv(fmac_dev_ctx->fpriv);
+	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
+
+	/* Group addressed and raw frames are not acknowledged */
+	if (pkt_info->peer_id >= MAX_PEERS) {
+		return;
+	}
+
+	peer = &sys_dev_ctx->tx_config.peers[pkt_info->peer_id];
+
+	if (peer->peer_id != (int)pkt_info->peer_id) {
+		return;
+	}
+
+	ac = tx_desc_ac_get(fmac_dev_ctx, desc);
+	ctrl = &peer->aggr_ctrl[ac];
+
+	num_frames = sys_dev_ctx->tx_config.send_pkt_coalesce_count_p[desc];
+
+	if (!num_frames) {
+		return;
+	}
+
+	num_status = tx_done_num_status_get(config);
+
+	for (frame = 0; frame < num_frames && frame < num_status; frame++) {
+		if (config->tx_status_code[frame] != NRF_WIFI_TX_STATUS_SUCCESS) {
+			num_failed++;
+		}
+	}
+
+	if (!ctrl->max_frames) {
+		ctrl->max_frames = sys_fpriv->data_config.max_tx_aggregation;
+		ctrl->max_bytes = sys_fpriv->avail_ampdu_len_per_token;
+	}
+
+	/* Halve the frame limit on heavy loss, else probe upwards when the
+	 * limit was what closed the token.
+	 */
+	if (num_failed * 4 > num_frames) {
+		ctrl->max_frames = (ctrl->max_frames > 1) ? (ctrl->max_frames / 2) : 1;
+	} else if (num_frames >= ctrl->max_frames &&
+		   ctrl->max_frames < sys_fpriv->data_config.max_tx_aggregation) {
+		ctrl->max_frames++;
+	}
+
+	air_us = tx_done_air_us_get(config);
+
+	if (!air_us || num_failed == num_frames) {
+		return;
+	}
+
+	rate_bpms = (unsigned int)(((unsigned long long)pkt_info->aggr_bytes *
+				    (num_frames - num_failed) * 1000) /
+				   ((unsigned long long)num_frames * air_us));
+
+	if (!ctrl->rate_bpms) {
+		ctrl->rate_bpms = rate_bpms;
+	} else {
+		ctrl->rate_bpms += (int)(rate_bpms - ctrl->rate_bpms) >>
+			NRF_WIFI_TX_AMPDU_ADAPT_AVG_SHIFT;
+	}
+
+	/* Size the token to take the target airtime at the current rate */
+	max_bytes = (unsigned int)(((unsigned long long)ctrl->rate_bpms *
+				    NRF_WIFI_TX_AMPDU_ADAPT_TARGET_US) / 1000);
+
+	if (max_bytes > sys_fpriv->avail_ampdu_len_per_token) {
+		max_bytes = sys_fpriv->avail_ampdu_len_per_token;
+	}
+
+	ctrl->max_bytes = max_bytes;
+}
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+
+
 static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
-				     unsigned char tx_desc_num)
+				     unsigned char tx_desc_num,
+				     struct nrf_wifi_tx_buff_done *config)
 {
 	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
 	struct nrf_wifi_fmac_priv *fpriv = NULL;
@@ -1384,6 +2716,29 @@ static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_d
 
 	pkt_info = &sys_dev_ctx->tx_config.pkt_info_p[desc];
 
+#ifdef NRF_WIFI_TX_STATUS_REPORT
+	if (config) {
+		tx_done_status_report(fmac_dev_ctx,
+				      desc,
+				      config->tx_status_code,
+				      tx_done_num_status_get(config));
+	}
+#endif /* NRF_WIFI_TX_STATUS_REPORT */
+#ifdef NRF_WIFI_TX_LATENCY_STATS
+	if (config) {
+		tx_done_latency_record(fmac_dev_ctx,
+				       desc,
+				       config);
+	}
+#endif /* NRF_WIFI_TX_LATENCY_STATS */
+#ifdef NRF_WIFI_TX_AMPDU_ADAPT
+	if (config) {
+		tx_aggr_ctrl_update(fmac_dev_ctx,
+				    desc,
+				    config);
+	}
+#endif /* NRF_WIFI_TX_AMPDU_ADAPT */
+
 	for (frame = 0;
 	     frame < sys_dev_ctx->tx_config.send_pkt_coalesce_count_p[desc];
 	     frame++) {
@@ -1421,6 +2776,8 @@ static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_d
 
 	pkts_pending = tx_buff_req_free(fmac_dev_ctx, tx_desc_num, &queue);
 
+	tx_flow_ctrl_wake(fmac_dev_ctx);
+
 	if (pkts_pending) {
 #ifdef NRF70_RAW_DATA_TX
 		struct nrf_wifi_fmac_vif_ctx *vif_ctx;
@@ -1447,6 +2804,10 @@ static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_d
 						     desc,
 						     pkt_info->peer_id);
 			} else {
+#ifdef NRF_WIFI_TWT_PRESTAGE
+				pkt_info->twt_ac = queue;
+				pkt_info->twt_held = true;
+#endif /* NRF_WIFI_TWT_PRESTAGE */
 				status = NRF_WIFI_STATUS_SUCCESS;
 			}
 #ifdef NRF70_RAW_DATA_TX
@@ -1460,6 +2821,10 @@ static enum nrf_wifi_status tx_done_process(struct nrf_wifi_fmac_dev_ctx *fmac_d
 			vif_ctx = sys_dev_ctx->vif_ctx[if_idx];
 			if ((vif_ctx->if_type == NRF_WIFI_STA_TX_INJECTOR) &&
 			    (sys_dev_ctx->twt_sleep_status == NRF_WIFI_FMAC_TWT_STATE_SLEEP)) {
+#ifdef NRF_WIFI_TWT_PRESTAGE
+				pkt_info->twt_ac = queue;
+				pkt_info->twt_held = true;
+#endif /* NRF_WIFI_TWT_PRESTAGE */
 				status = NRF_WIFI_STATUS_SUCCESS;
 			} else {
 				status = rawtx_cmd_init(fmac_dev_ctx,
@@ -1481,30 +2846,41 @@ static void tx_done_tasklet_fn(unsigned long data)
 {
 	struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx = (struct nrf_wifi_fmac_dev_ctx *)data;
 	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx;
+	struct nrf_wifi_tx_buff_done *config = NULL;
 	void *tx_done_tasklet_event_q;
 	enum NRF_WIFI_HAL_STATUS hal_status;
+	unsigned int budget = NRF70_TX_DONE_WQ_BUDGET;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+	tx_done_tasklet_event_q = sys_dev_ctx->tx_config.tx_done_tasklet_event_q;
 
 	nrf_wifi_sys_hal_lock_rx(fmac_dev_ctx->hal_dev_ctx);
 	hal_status = nrf_wifi_hal_status_unlocked(fmac_dev_ctx->hal_dev_ctx);
 	if (hal_status != NRF_WIFI_HAL_STATUS_ENABLED) {
+		sys_dev_ctx->tx_done_tasklet_scheduled = false;
 		goto out;
 	}
 
-	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
-	tx_done_tasklet_event_q = sys_dev_ctx->tx_done_tasklet_event_q;
+	sys_dev_ctx->host_stats.total_tx_done_tasklet_runs++;
 
-	struct nrf_wifi_tx_buff_done *config = nrf_wifi_utils_q_dequeue(
-		tx_done_tasklet_event_q);
+	while (budget--) {
+		config = nrf_wifi_utils_q_dequeue(tx_done_tasklet_event_q);
 
-	if (!config) {
-		nrf_wifi_osal_log_err("%s: TX done event Q is empty",
-				      __func__);
-		return;
-	}
+		if (!config) {
+			break;
+		}
 
-	(void) nrf_wifi_fmac_tx_done_event_process(fmac_dev_ctx, config);
+		(void) nrf_wifi_fmac_tx_done_event_process(fmac_dev_ctx, config);
+
+		nrf_wifi_osal_mem_free(config);
+		sys_dev_ctx->host_stats.total_tx_done_tasklet_events++;
+	}
 
-	nrf_wifi_osal_mem_free(config);
+	if (nrf_wifi_utils_q_len(tx_done_tasklet_event_q)) {
+		nrf_wifi_osal_tasklet_schedule(sys_dev_ctx->tx_done_tasklet);
+	} else {
+		sys_dev_ctx->tx_done_tasklet_scheduled = false;
+	}
 out:
 	nrf_wifi_sys_hal_unlock_rx(fmac_dev_ctx->hal_dev_ctx);
 }
@@ -1543,7 +2919,8 @@ enum nrf_wifi_status nrf_wifi_fmac_rawtx_done_event_process(
 	}
 
 	status = tx_done_process(fmac_dev_ctx,
-				 config->desc_num);
+				 config->desc_num,
+				 NULL);
 
 	if (status != NRF_WIFI_STATUS_SUCCESS) {
 		nrf_wifi_osal_log_err("%s: Process raw tx done failed",
@@ -1582,7 +2959,8 @@ enum nrf_wifi_status (nrf_wifi_fmac_tx_done_event_process)(
 	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
 
 	status = tx_done_process(fmac_dev_ctx,
-				 config->tx_desc_num);
+				 config->tx_desc_num,
+				 config);
 
 	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
 
@@ -1625,6 +3003,14 @@ static enum nrf_wifi_fmac_tx_status nrf_wifi_fmac_tx(struct nrf_wifi_fmac_dev_ct
 			    ac,
 			    peer_id);
 
+	if (status == NRF_WIFI_FMAC_TX_STATUS_FAIL) {
+		goto out;
+	}
+
+	tx_flow_ctrl_stop(fmac_dev_ctx,
+			  if_id,
+			  ac);
+
 	if (status != NRF_WIFI_FMAC_TX_STATUS_SUCCESS) {
 		goto out;
 	}
@@ -1757,6 +3143,34 @@ enum nrf_wifi_status tx_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 
 	sys_dev_ctx->twt_sleep_status = NRF_WIFI_FMAC_TWT_STATE_AWAKE;
 
+#ifdef NRF_WIFI_TX_SHAPING
+	sys_dev_ctx->tx_config.shaper_timer = nrf_wifi_osal_timer_alloc();
+
+	if (!sys_dev_ctx->tx_config.shaper_timer) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate shaper timer",
+				      __func__);
+		goto wakeup_client_q_free;
+	}
+
+	nrf_wifi_osal_timer_init(sys_dev_ctx->tx_config.shaper_timer,
+				 tx_shaper_timer_fn,
+				 (unsigned long)fmac_dev_ctx);
+#endif /* NRF_WIFI_TX_SHAPING */
+
+#ifdef NRF_WIFI_TWT_PRESTAGE
+	sys_dev_ctx->tx_config.twt_prestage_timer = nrf_wifi_osal_timer_alloc();
+
+	if (!sys_dev_ctx->tx_config.twt_prestage_timer) {
+		nrf_wifi_osal_log_err("%s: Unable to allocate TWT pre-staging timer",
+				      __func__);
+		goto wakeup_client_q_free;
+	}
+
+	nrf_wifi_osal_timer_init(sys_dev_ctx->tx_config.twt_prestage_timer,
+				 tx_twt_prestage_timer_fn,
+				 (unsigned long)fmac_dev_ctx);
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+
 #ifdef NRF70_TX_DONE_WQ_ENABLED
 	sys_dev_ctx->tx_done_tasklet = nrf_wifi_osal_tasklet_alloc(NRF_WIFI_TASKLET_TYPE_TX_DONE);
 	if (!sys_dev_ctx->tx_done_tasklet) {
@@ -1779,9 +3193,24 @@ enum nrf_wifi_status tx_init(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 #ifdef NRF70_TX_DONE_WQ_ENABLED
 tx_done_tasklet_free:
 	nrf_wifi_osal_tasklet_free(sys_dev_ctx->tx_done_tasklet);
+#endif /* NRF70_TX_DONE_WQ_ENABLED */
+#if defined(NRF70_TX_DONE_WQ_ENABLED) || defined(NRF_WIFI_TX_SHAPING) || \
+	defined(NRF_WIFI_TWT_PRESTAGE)
 wakeup_client_q_free:
+#ifdef NRF_WIFI_TWT_PRESTAGE
+	if (sys_dev_ctx->tx_config.twt_prestage_timer) {
+		nrf_wifi_osal_timer_free(sys_dev_ctx->tx_config.twt_prestage_timer);
+		sys_dev_ctx->tx_config.twt_prestage_timer = NULL;
+	}
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+#ifdef NRF_WIFI_TX_SHAPING
+	if (sys_dev_ctx->tx_config.shaper_timer) {
+		nrf_wifi_osal_timer_free(sys_dev_ctx->tx_config.shaper_timer);
+		sys_dev_ctx->tx_config.shaper_timer = NULL;
+	}
+#endif /* NRF_WIFI_TX_SHAPING */
 	nrf_wifi_utils_q_free(sys_dev_ctx->tx_config.wakeup_client_q);
-#endif /* NRF70_TX_DONE_WQ_ENABLED */
+#endif /* NRF70_TX_DONE_WQ_ENABLED || NRF_WIFI_TX_SHAPING || NRF_WIFI_TWT_PRESTAGE */
 tx_spin_lock_free:
 	nrf_wifi_osal_spinlock_free(sys_dev_ctx->tx_config.tx_lock);
 tx_buff_map_free:
@@ -1820,6 +3249,16 @@ void tx_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 	sys_fpriv = wifi_fmac_priv(fpriv);
 	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
 
+#ifdef NRF_WIFI_TX_SHAPING
+	nrf_wifi_osal_timer_kill(sys_dev_ctx->tx_config.shaper_timer);
+	nrf_wifi_osal_timer_free(sys_dev_ctx->tx_config.shaper_timer);
+#endif /* NRF_WIFI_TX_SHAPING */
+
+#ifdef NRF_WIFI_TWT_PRESTAGE
+	nrf_wifi_osal_timer_kill(sys_dev_ctx->tx_config.twt_prestage_timer);
+	nrf_wifi_osal_timer_free(sys_dev_ctx->tx_config.twt_prestage_timer);
+#endif /* NRF_WIFI_TWT_PRESTAGE */
+
 #ifdef NRF70_TX_DONE_WQ_ENABLED
 	/* TODO: Need to deinit network buffers? */
 	nrf_wifi_osal_tasklet_free(sys_dev_ctx->tx_done_tasklet);
@@ -1833,6 +3272,11 @@ void tx_deinit(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx)
 
 	for (i = 0; i < sys_fpriv->num_tx_tokens; i++) {
 		if (sys_dev_ctx->tx_config.pkt_info_p) {
+#ifdef NRF_WIFI_TWT_PRESTAGE
+			if (sys_dev_ctx->tx_config.pkt_info_p[i].twt_staged_cmd) {
+				nrf_wifi_osal_mem_free(sys_dev_ctx->tx_config.pkt_info_p[i].twt_staged_cmd);
+			}
+#endif /* NRF_WIFI_TWT_PRESTAGE */
 			while (nrf_wifi_utils_q_len(sys_dev_ctx->tx_config.pkt_info_p[i].pkt)) {
 				nrf_wifi_osal_nbuf_free(
 					nrf_wifi_utils_q_dequeue(sys_dev_ctx->tx_config.pkt_info_p[i].pkt));
@@ -1994,6 +3438,105 @@ fail:
 }
 #endif /* NRF70_RAW_DATA_TX */
 
+#ifdef NRF_WIFI_MCAST_TO_UCAST
+/* Send a multicast frame as one unicast copy per receiving peer. Returns
+ * false if the frame has to be sent as multicast, otherwise the frame has
+ * been consumed.
+ */
+static bool tx_mc2uc(struct nrf_wifi_fmac_dev_ctx *fmac_dev_ctx,
+		     unsigned char if_idx,
+		     void *nbuf)
+{
+	struct nrf_wifi_sys_fmac_dev_ctx *sys_dev_ctx = NULL;
+	struct nrf_wifi_fmac_mc2uc_stats *stats = NULL;
+	struct nrf_wifi_fmac_mc2uc_peer *peer = NULL;
+	struct nrf_wifi_fmac_mc2uc_peer peers[MAX_PEERS];
+	unsigned int copies = 0;
+	unsigned int copy_fail = 0;
+	int num_peers = 0;
+	void *copy = NULL;
+	unsigned char *data = NULL;
+	unsigned int len = 0;
+	int ac = 0;
+	int i = 0;
+
+	sys_dev_ctx = wifi_dev_priv(fmac_dev_ctx);
+
+	num_peers = nrf_wifi_fmac_mc2uc_peers_get(fmac_dev_ctx,
+						  if_idx,
+						  nbuf,
+						  peers);
+
+	if (num_peers < 0) {
+		return false;
+	}
+
+	stats = &sys_dev_ctx->vif_ctx[if_idx]->mc2uc_stats;
+	len = nrf_wifi_osal_nbuf_data_size(nbuf);
+
+	for (i = 0; i < num_peers; i++) {
+		peer = &peers[i];
+
+		/* Every copy is owned by the TX path like any other frame */
+		copy = nrf_wifi_osal_nbuf_alloc(len);
+
+		if (!copy) {
+			copy_fail++;
+			continue;
+		}
+
+		data = nrf_wifi_osal_nbuf_data_put(copy,
+						   len);
+
+		nrf_wifi_osal_mem_cpy(data,
+				      nrf_wifi_osal_nbuf_data_get(nbuf),
+				      len);
+
+		/* The RA is taken from the destination address */
+		nrf_wifi_osal_mem_cpy(data,
+				      peer->ra_addr,
+				      NRF_WIFI_FMAC_ETH_ADDR_LEN);
+
+		if (peer->qos_supported) {
+			ac = get_ac(nrf_wifi_get_tid(copy), peer->ra_addr);
+		} else {
+			ac = NRF_WIFI_FMAC_AC_BE;
+		}
+
+		if (nrf_wifi_fmac_tx(fmac_dev_ctx,
+				     if_idx,
+				     copy,
+				     ac,
+				     peer->peer_id) == NRF_WIFI_FMAC_TX_STATUS_FAIL) {
+			nrf_wifi_osal_nbuf_free(copy);
+			copy_fail++;
+			continue;
+		}
+
+		copies++;
+	}
+
+	/* The statistics are shared with the RX snoop and the other TX
+	 * contexts, nrf_wifi_fmac_tx() takes the TX lock itself.
+	 */
+	nrf_wifi_osal_spinlock_take(sys_dev_ctx->tx_config.tx_lock);
+
+	stats->copies += copies;
+	stats->copy_fail += copy_fail;
+
+	if (num_peers) {
+		stats->converted++;
+	}
+
+	nrf_wifi_osal_spinlock_rel(sys_dev_ctx->tx_config.tx_lock);
+
+	nrf_wifi_osal_nbuf_free(nbuf);
+
+	return true;
+}
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+
+
 enum nrf_wifi_status nrf_wifi_fmac_start_xmit(void *dev_ctx,
 					      unsigned char if_idx,
 					      void *nbuf)
@@ -2022,6 +3565,13 @@ enum nrf_wifi_status nrf_wifi_fmac_start_xmit(void *dev_ctx,
 
 	peer_id = nrf_wifi_fmac_peer_get_id(fmac_dev_ctx, ra);
 
+#ifdef NRF_WIFI_MCAST_TO_UCAST
+	if ((peer_id == MAX_PEERS) &&
+	    tx_mc2uc(fmac_dev_ctx, if_idx, nbuf)) {
+		return NRF_WIFI_STATUS_SUCCESS;
+	}
+#endif /* NRF_WIFI_MCAST_TO_UCAST */
+
 	if (peer_id == -1) {
 		nrf_wifi_osal_log_err("%s: Got packet for unknown PEER",
 				      __func__);
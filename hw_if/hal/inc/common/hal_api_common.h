@@ -229,6 +229,22 @@ enum nrf_wifi_status nrf_wifi_hal_otp_ft_prog_ver_get(struct nrf_wifi_hal_dev_ct
 enum nrf_wifi_status nrf_wifi_hal_otp_pack_info_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 			unsigned int *package_info);
 
+#ifdef NRF_WIFI_OTP_CACHE
+/**
+ * @brief Get the OTP UUID for the Wi-Fi HAL.
+ *
+ * This function reads only the UUID words of the OTP information, which is
+ * enough to check whether cached OTP parameters belong to this chip.
+ *
+ * @param hal_dev_ctx     Pointer to the Wi-Fi HAL device context.
+ * @param uuid            Pointer to the UUID (4 words).
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_hal_otp_uuid_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+			unsigned int *uuid);
+#endif /* NRF_WIFI_OTP_CACHE */
+
 enum nrf_wifi_status hal_rpu_ps_init(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx);
 
 enum nrf_wifi_status nrf_wifi_hal_irq_handler(void *data);
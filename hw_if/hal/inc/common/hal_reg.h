@@ -53,4 +53,29 @@ enum nrf_wifi_status hal_rpu_reg_read(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 enum nrf_wifi_status hal_rpu_reg_write(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 		unsigned int rpu_reg_addr,
 		unsigned int val);
+
+/**
+ * @brief Write a burst of values to RPU register(s).
+ *
+ * @param hal_ctx Pointer to HAL context.
+ * @param rpu_reg_addr Absolute value of the (first) RPU register address to
+ *                     which the values are to be written.
+ * @param vals Pointer to the 4 byte values which are to be written.
+ * @param num_vals Number of values to be written.
+ * @param reg_addr_inc Whether each value goes to the next register (true) or
+ *                     all the values go to the same data register (false).
+ *
+ * This function writes the values back to back, translating the register
+ * address once and waking up the RPU once per chunk of values instead of
+ * once per value.
+ *
+ * @return Status
+ *         - Pass: NRF_WIFI_STATUS_SUCCESS
+ *         - Error: NRF_WIFI_STATUS_FAIL
+ */
+enum nrf_wifi_status hal_rpu_reg_write_burst(struct nrf_wifi_hal_dev_ctx *hal_ctx,
+		unsigned int rpu_reg_addr,
+		const unsigned int *vals,
+		unsigned int num_vals,
+		bool reg_addr_inc);
 #endif /* __HAL_REG_H__ */
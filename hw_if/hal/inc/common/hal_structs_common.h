@@ -21,6 +21,17 @@
  /** 1 sec */
 #define MAX_HAL_RPU_READY_WAIT (1 * 1000 * 1000)
 
+#if defined(NRF70_TX_PACK_SMALL_FRAMES) || defined(__DOXYGEN__)
+/** Size of the host staging buffer used to coalesce TX bounce buffer writes */
+#ifndef NRF70_TX_PACK_BUF_SIZE
+#define NRF70_TX_PACK_BUF_SIZE 2048
+#endif /* NRF70_TX_PACK_BUF_SIZE */
+/** Frames larger than this are written to the RPU directly */
+#ifndef NRF70_TX_PACK_MAX_FRM_SZ
+#define NRF70_TX_PACK_MAX_FRM_SZ 512
+#endif /* NRF70_TX_PACK_MAX_FRM_SZ */
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
+
 #if defined(NRF_WIFI_LOW_POWER) || defined(__DOXYGEN__)
 #define RPU_PS_WAKE_INTERVAL_MS 1
 #define RPU_PS_WAKE_TIMEOUT_S 1
@@ -135,6 +146,10 @@ struct nrf_wifi_hal_buf_map_info {
 	unsigned long phy_addr;
 	/** Length of the buffer */
 	unsigned int buf_len;
+#if defined(NRF_WIFI_RX_PERSIST_DMA_MAP) || defined(__DOXYGEN__)
+	/** Long lived DMA address of the RX bounce buffer backing this slot */
+	unsigned long persist_phy_addr;
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
 };
 
 /**
@@ -243,6 +258,22 @@ struct nrf_wifi_hal_dev_ctx {
 	unsigned long addr_rpu_pktram_base_rx_pool[MAX_NUM_OF_RX_QUEUES];
 	/** TX frame offset */
 	unsigned long tx_frame_offset;
+#if defined(NRF70_TX_PACK_SMALL_FRAMES) || defined(__DOXYGEN__)
+	/** Host staging buffer for small TX frames of the current token */
+	unsigned char *tx_pack_buf;
+	/** RPU address the staging buffer will be written to */
+	unsigned long tx_pack_rpu_addr;
+	/** Number of valid bytes in the staging buffer */
+	unsigned int tx_pack_len;
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
+#if defined(NRF_WIFI_PATCH_HASH_CHECK) || defined(__DOXYGEN__)
+	/** Callback invoked with every FW patch chunk written to the RPU */
+	void (*fw_patch_chunk_callbk_fn)(void *callbk_data,
+					 const void *chunk,
+					 unsigned int chunk_len);
+	/** Data passed to the FW patch chunk callback */
+	void *fw_patch_chunk_callbk_data;
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
 #if defined(NRF_WIFI_RPU_RECOVERY)  || defined(__DOXYGEN__)
 	/** RPU wake up now asserted flag */
 	bool is_wakeup_now_asserted;
@@ -271,12 +302,10 @@ struct nrf_wifi_hal_dev_ctx {
 	/** RPU firmware booted flag */
 	bool rpu_fw_booted;
 #endif /* NRF_WIFI_LOW_POWER */
-	/** Event data */
-	char *event_data;
+	/** HAL message into which the current event is being assembled */
+	struct nrf_wifi_hal_msg *event_msg;
 	/** Current event data */
 	char *event_data_curr;
-	/** Event data length */
-	unsigned int event_data_len;
 	/** Pending event data */
 	unsigned int event_data_pending;
 	/** Event resubmit flag */
@@ -68,6 +68,31 @@ enum nrf_wifi_fw_subtype {
 
 bool pal_check_rpu_mcu_regions(enum RPU_PROC_TYPE proc, unsigned int addr_val);
 
+/* Fast path translation for the packet RAM and GRAM windows, which are
+ * accessed for every command, event and data buffer. Returns false if the
+ * address is outside these windows, pal_rpu_addr_offset_get() then needs to
+ * be used.
+ */
+static inline bool pal_rpu_ram_addr_offset_get(unsigned int rpu_addr,
+					       unsigned long *addr)
+{
+	if ((rpu_addr >= RPU_ADDR_PKTRAM_START) &&
+	    (rpu_addr <= RPU_ADDR_PKTRAM_END)) {
+		*addr = SOC_MMAP_ADDR_OFFSET_PKTRAM_HOST_VIEW +
+			(rpu_addr & RPU_ADDR_MASK_OFFSET);
+		return true;
+	}
+
+	if ((rpu_addr >= RPU_ADDR_GRAM_START) &&
+	    (rpu_addr <= RPU_ADDR_GRAM_END)) {
+		*addr = SOC_MMAP_ADDR_OFFSET_GRAM_PKD +
+			(rpu_addr & RPU_ADDR_MASK_OFFSET);
+		return true;
+	}
+
+	return false;
+}
+
 static inline enum RPU_MCU_ADDR_REGIONS pal_mem_type_to_region(enum HAL_RPU_MEM_TYPE mem_type)
 {
 	switch (mem_type) {
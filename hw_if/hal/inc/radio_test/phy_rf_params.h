@@ -19,6 +19,9 @@
 #define MAX_CAPTURE_LEN 16383
 #define MIN_CAPTURE_LEN 0
 #define RX_CAPTURE_TIMEOUT_CONST 11
+/* Each RX capture sample is 3 bytes, 4 samples make up a 32-bit aligned chunk */
+#define RF_TEST_CAP_SAMPLE_SZ 3
+#define RF_TEST_CAP_CHUNK_ALIGN_SAMPLES 4
 #define CAPTURE_DURATION_IN_SEC 600
 
 #define VBAT_OFFSET_MILLIVOLT (2500)
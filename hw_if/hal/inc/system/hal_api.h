@@ -111,6 +111,22 @@ unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_ctx,
 					  unsigned int token,
 					  unsigned int buf_indx);
 
+#if defined(NRF70_TX_PACK_SMALL_FRAMES) || defined(__DOXYGEN__)
+/**
+ * @brief Write out the small TX frames staged by nrf_wifi_sys_hal_buf_map_tx.
+ *
+ * Small frames belonging to the same token are staged in a host buffer
+ * and written to the RPU packet RAM in a single bus transaction. This
+ * needs to be called once all the frames of a token have been mapped and
+ * before the TX command is sent to the RPU.
+ *
+ * @param hal_ctx     Pointer to the Wi-Fi HAL device context.
+ *
+ * @return The status of the operation.
+ */
+enum nrf_wifi_status nrf_wifi_sys_hal_buf_map_tx_flush(struct nrf_wifi_hal_dev_ctx *hal_ctx);
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
+
 /**
  * @brief Unmap a transmit buffer from the Wi-Fi HAL.
  *
@@ -685,6 +685,10 @@ void nrf_wifi_hal_proc_ctx_set(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 void nrf_wifi_hal_dev_rem(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 {
 	unsigned int i = 0;
+#ifdef NRF_WIFI_RX_PERSIST_DMA_MAP
+	struct nrf_wifi_hal_buf_map_info *rx_buf_info = NULL;
+	unsigned int j = 0;
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
 
 	nrf_wifi_osal_tasklet_kill(hal_dev_ctx->recovery_tasklet);
 	nrf_wifi_osal_tasklet_free(hal_dev_ctx->recovery_tasklet);
@@ -696,6 +700,12 @@ void nrf_wifi_hal_dev_rem(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 
 	hal_rpu_eventq_drain(hal_dev_ctx);
 
+	/* Drop any partially assembled fragmented event */
+	if (hal_dev_ctx->event_msg) {
+		nrf_wifi_osal_mem_free(hal_dev_ctx->event_msg);
+		hal_dev_ctx->event_msg = NULL;
+	}
+
 	nrf_wifi_osal_spinlock_free(hal_dev_ctx->lock_hal);
 	nrf_wifi_osal_spinlock_free(hal_dev_ctx->lock_rx);
 
@@ -707,8 +717,35 @@ void nrf_wifi_hal_dev_rem(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 	hal_rpu_ps_deinit(hal_dev_ctx);
 #endif /* NRF_WIFI_LOW_POWER */
 
+#ifdef NRF_WIFI_RX_PERSIST_DMA_MAP
+	for (i = 0; i < MAX_NUM_OF_RX_QUEUES; i++) {
+		if (!hal_dev_ctx->rx_buf_info[i]) {
+			continue;
+		}
+
+		for (j = 0; j < hal_dev_ctx->hpriv->cfg_params.rx_buf_pool[i].num_bufs; j++) {
+			rx_buf_info = &hal_dev_ctx->rx_buf_info[i][j];
+
+			if (!rx_buf_info->persist_phy_addr) {
+				continue;
+			}
+
+			nrf_wifi_bal_dma_unmap(hal_dev_ctx->bal_dev_ctx,
+					       rx_buf_info->persist_phy_addr,
+					       hal_dev_ctx->hpriv->cfg_params.rx_buf_pool[i].buf_sz,
+					       NRF_WIFI_OSAL_DMA_DIR_FROM_DEV);
+			rx_buf_info->persist_phy_addr = 0;
+		}
+	}
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
+
 	nrf_wifi_bal_dev_rem(hal_dev_ctx->bal_dev_ctx);
 
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+	nrf_wifi_osal_mem_free(hal_dev_ctx->tx_pack_buf);
+	hal_dev_ctx->tx_pack_buf = NULL;
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
+
 	nrf_wifi_osal_mem_free(hal_dev_ctx->tx_buf_info);
 	hal_dev_ctx->tx_buf_info = NULL;
 
@@ -941,6 +978,12 @@ out:
 
 
 #define MCU_FW_BOOT_TIMEOUT_MS 1000
+/* The boot signature is polled with an exponential backoff starting at
+ * MCU_FW_BOOT_POLL_MIN_MS and capped at MCU_FW_BOOT_POLL_MAX_MS, so that a
+ * quick boot is detected without paying for a full coarse poll interval.
+ */
+#define MCU_FW_BOOT_POLL_MIN_MS 1
+#define MCU_FW_BOOT_POLL_MAX_MS 10
 enum nrf_wifi_status nrf_wifi_hal_fw_chk_boot(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 					      enum RPU_PROC_TYPE rpu_proc)
 {
@@ -948,7 +991,9 @@ enum nrf_wifi_status nrf_wifi_hal_fw_chk_boot(struct nrf_wifi_hal_dev_ctx *hal_d
 	unsigned int addr = 0;
 	unsigned int val = 0;
 	unsigned int exp_val = 0;
-	int mcu_ready_wait_count = MCU_FW_BOOT_TIMEOUT_MS / 10;
+	unsigned int poll_ms = MCU_FW_BOOT_POLL_MIN_MS;
+	unsigned long start_time_ms = 0;
+	bool boot_done = false;
 
 	if (rpu_proc == RPU_PROC_TYPE_MCU_LMAC) {
 		addr = RPU_MEM_LMAC_BOOT_SIG;
@@ -964,7 +1009,9 @@ enum nrf_wifi_status nrf_wifi_hal_fw_chk_boot(struct nrf_wifi_hal_dev_ctx *hal_d
 
 	hal_dev_ctx->curr_proc = rpu_proc;
 
-	while (mcu_ready_wait_count-- > 0) {
+	start_time_ms = nrf_wifi_osal_time_get_curr_ms();
+
+	while (1) {
 		status = hal_rpu_mem_read(hal_dev_ctx,
 					  (unsigned char *)&val,
 					  addr,
@@ -977,14 +1024,26 @@ enum nrf_wifi_status nrf_wifi_hal_fw_chk_boot(struct nrf_wifi_hal_dev_ctx *hal_d
 		}
 
 		if (val == exp_val) {
+			boot_done = true;
 			break;
 		}
 
-		/* Sleep for 10 ms */
-		nrf_wifi_osal_sleep_ms(10);
+		if (nrf_wifi_osal_time_elapsed_ms(start_time_ms) >= MCU_FW_BOOT_TIMEOUT_MS) {
+			break;
+		}
+
+		nrf_wifi_osal_sleep_ms(poll_ms);
+
+		if (poll_ms < MCU_FW_BOOT_POLL_MAX_MS) {
+			poll_ms *= 2;
+
+			if (poll_ms > MCU_FW_BOOT_POLL_MAX_MS) {
+				poll_ms = MCU_FW_BOOT_POLL_MAX_MS;
+			}
+		}
 	};
 
-	if (mcu_ready_wait_count <= 0) {
+	if (!boot_done) {
 		nrf_wifi_osal_log_err("%s: Boot_sig check failed for RPU(%d), "
 				      "Expected: 0x%X, Actual: 0x%X",
 				      __func__,
@@ -1152,6 +1211,34 @@ out:
 	return status;
 }
 
+#ifdef NRF_WIFI_OTP_CACHE
+enum nrf_wifi_status nrf_wifi_hal_otp_uuid_get(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					       unsigned int *uuid)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+
+	if (!hal_dev_ctx || !uuid) {
+		nrf_wifi_osal_log_err("%s: Invalid parameters",
+				      __func__);
+		goto out;
+	}
+
+	status = hal_rpu_mem_read(hal_dev_ctx,
+				  uuid,
+				  RPU_MEM_UMAC_BOOT_SIG +
+				  offsetof(struct host_rpu_umac_info, info_uuid),
+				  sizeof(((struct host_rpu_umac_info *)0)->info_uuid));
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: OTP UUID get failed",
+				      __func__);
+		goto out;
+	}
+out:
+	return status;
+}
+#endif /* NRF_WIFI_OTP_CACHE */
+
 void nrf_wifi_hal_enable(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
 {
 	nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->lock_rx,
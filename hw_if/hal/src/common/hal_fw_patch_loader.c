@@ -16,8 +16,20 @@
 #include "lmac_if_common.h"
 #include "host_rpu_common_if.h"
 
-/* To reduce HEAP maximum usage */
+/* Size of each burst written to the RPU memory while downloading a patch.
+ * The patches are written directly from the firmware image, so this does
+ * not impact the heap usage and can be tuned to the optimal bus transfer size.
+ */
+#ifdef NRF70_FW_PATCH_CHUNK_SIZE
+#define MAX_PATCH_CHUNK_SIZE NRF70_FW_PATCH_CHUNK_SIZE
+#else
 #define MAX_PATCH_CHUNK_SIZE 8192
+#endif /* NRF70_FW_PATCH_CHUNK_SIZE */
+
+/* The RPU memory is written in 32-bit words */
+#if (MAX_PATCH_CHUNK_SIZE % 4) || (MAX_PATCH_CHUNK_SIZE <= 0)
+#error "NRF70_FW_PATCH_CHUNK_SIZE must be a positive multiple of 4"
+#endif
 #ifndef ARRAY_SIZE
 #define ARRAY_SIZE(array) (sizeof(array) / sizeof((array)[0]))
 #endif /* ARRAY_SIZE */
@@ -79,7 +91,10 @@ enum nrf_wifi_status hal_fw_patch_chunk_load(struct nrf_wifi_hal_dev_ctx *hal_de
 	return status;
 }
 
-/* In order to save RAM, divide the patch in to chunks download */
+/* Download the patch in chunks. The chunks are written directly from the
+ * firmware image, a bounce buffer is only used in case the image is not word
+ * aligned as the indirect core memory writes access the data as words.
+ */
 static enum nrf_wifi_status hal_fw_patch_load(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 						enum RPU_PROC_TYPE rpu_proc,
 						const char *patch_id_str,
@@ -91,34 +106,36 @@ static enum nrf_wifi_status hal_fw_patch_load(struct nrf_wifi_hal_dev_ctx *hal_d
 	int last_chunk_size = fw_patch_size % MAX_PATCH_CHUNK_SIZE;
 	int num_chunks = fw_patch_size / MAX_PATCH_CHUNK_SIZE +
 					(last_chunk_size ? 1 : 0);
+	unsigned char *patch_data_ram = NULL;
 	int chunk = 0;
 
-	for (chunk = 0; chunk < num_chunks; chunk++) {
-		unsigned char *patch_data_ram;
-		unsigned int patch_chunk_size =
-			((chunk == num_chunks - 1) ? last_chunk_size : MAX_PATCH_CHUNK_SIZE);
-		const void *src_patch_offset = (const char *)fw_patch_data +
-			chunk * MAX_PATCH_CHUNK_SIZE;
-		int dest_chunk_offset = dest_addr + chunk * MAX_PATCH_CHUNK_SIZE;
-
-		patch_data_ram = nrf_wifi_osal_mem_alloc(patch_chunk_size);
+	if (((unsigned long)fw_patch_data) & 0x3) {
+		patch_data_ram = nrf_wifi_osal_mem_alloc(MAX_PATCH_CHUNK_SIZE);
 		if (!patch_data_ram) {
-			nrf_wifi_osal_log_err("%s: Mem alloc failed for patch "
-					      "%s-%s: chunk %d/%d, size: %d",
+			nrf_wifi_osal_log_err("%s: Mem alloc failed for patch %s-%s, size: %d",
 					      __func__,
 					      rpu_proc_to_str(rpu_proc),
 					      patch_id_str,
-					      chunk + 1,
-					      num_chunks,
-					      patch_chunk_size);
-			status = NRF_WIFI_STATUS_FAIL;
+					      MAX_PATCH_CHUNK_SIZE);
 			goto out;
 		}
+	}
 
-		nrf_wifi_osal_mem_cpy(patch_data_ram,
-				      src_patch_offset,
-				      patch_chunk_size);
+	for (chunk = 0; chunk < num_chunks; chunk++) {
+		unsigned int patch_chunk_size =
+			((chunk == num_chunks - 1 && last_chunk_size) ?
+			 last_chunk_size : MAX_PATCH_CHUNK_SIZE);
+		const void *src_patch_offset = (const char *)fw_patch_data +
+			chunk * MAX_PATCH_CHUNK_SIZE;
+		const void *chunk_data = src_patch_offset;
+		int dest_chunk_offset = dest_addr + chunk * MAX_PATCH_CHUNK_SIZE;
 
+		if (patch_data_ram) {
+			nrf_wifi_osal_mem_cpy(patch_data_ram,
+					      src_patch_offset,
+					      patch_chunk_size);
+			chunk_data = patch_data_ram;
+		}
 
 		nrf_wifi_osal_log_dbg("%s: Copying patch %s-%s: chunk %d/%d, size: %d",
 				      __func__,
@@ -131,7 +148,7 @@ static enum nrf_wifi_status hal_fw_patch_load(struct nrf_wifi_hal_dev_ctx *hal_d
 		status = hal_fw_patch_chunk_load(hal_dev_ctx,
 						rpu_proc,
 						dest_chunk_offset,
-						patch_data_ram,
+						chunk_data,
 						patch_chunk_size);
 		if (status != NRF_WIFI_STATUS_SUCCESS) {
 			nrf_wifi_osal_log_err("%s: Patch copy %s-%s: chunk %d/%d, size: %d failed",
@@ -143,12 +160,19 @@ static enum nrf_wifi_status hal_fw_patch_load(struct nrf_wifi_hal_dev_ctx *hal_d
 					      patch_chunk_size);
 			goto out;
 		}
-out:
-		if (patch_data_ram)
-			nrf_wifi_osal_mem_free(patch_data_ram);
-		if (status != NRF_WIFI_STATUS_SUCCESS)
-			break;
+
+#ifdef NRF_WIFI_PATCH_HASH_CHECK
+		/* Let the caller digest the chunk while it is still hot in the cache */
+		if (hal_dev_ctx->fw_patch_chunk_callbk_fn) {
+			hal_dev_ctx->fw_patch_chunk_callbk_fn(hal_dev_ctx->fw_patch_chunk_callbk_data,
+							      src_patch_offset,
+							      patch_chunk_size);
+		}
+#endif /* NRF_WIFI_PATCH_HASH_CHECK */
 	}
+out:
+	if (patch_data_ram)
+		nrf_wifi_osal_mem_free(patch_data_ram);
 
 	return status;
 }
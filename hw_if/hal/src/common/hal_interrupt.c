@@ -257,18 +257,22 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 
 		rpu_msg_len = rpu_msg_hdr->len;
 
-		/* Allocate space to assemble the entire event */
-		hal_dev_ctx->event_data = nrf_wifi_osal_mem_zalloc(rpu_msg_len);
+		/* Allocate the HAL message which will be queued upfront, so that
+		 * the event (or each of its fragments) is read from the RPU
+		 * directly into its final location.
+		 */
+		hal_dev_ctx->event_msg = nrf_wifi_osal_mem_zalloc(sizeof(*hal_dev_ctx->event_msg) +
+								  rpu_msg_len);
 
-		if (!hal_dev_ctx->event_data) {
-			nrf_wifi_osal_log_err("%s: Unable to alloc buff for event data",
-					      __func__);
+		if (!hal_dev_ctx->event_msg) {
+			nrf_wifi_osal_log_err("%s: Unable to alloc HAL msg for event (%d bytes)",
+					      __func__,
+					      rpu_msg_len);
 			goto out;
-		} else {
-			hal_dev_ctx->event_data_curr = hal_dev_ctx->event_data;
 		}
 
-		hal_dev_ctx->event_data_len = rpu_msg_len;
+		hal_dev_ctx->event_msg->len = rpu_msg_len;
+		hal_dev_ctx->event_data_curr = hal_dev_ctx->event_msg->data;
 		hal_dev_ctx->event_data_pending = rpu_msg_len;
 		hal_dev_ctx->event_resubmit = rpu_msg_hdr->resubmit;
 
@@ -283,8 +287,8 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 			if (status != NRF_WIFI_STATUS_SUCCESS) {
 				nrf_wifi_osal_log_err("%s: Reading of first event fragment failed",
 						      __func__);
-				nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-				hal_dev_ctx->event_data = NULL;
+				nrf_wifi_osal_mem_free(hal_dev_ctx->event_msg);
+				hal_dev_ctx->event_msg = NULL;
 				goto out;
 			}
 
@@ -296,8 +300,8 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 				if (status != NRF_WIFI_STATUS_SUCCESS) {
 					nrf_wifi_osal_log_err("%s: Freeing up of the event failed",
 							      __func__);
-					nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-					hal_dev_ctx->event_data = NULL;
+					nrf_wifi_osal_mem_free(hal_dev_ctx->event_msg);
+					hal_dev_ctx->event_msg = NULL;
 					goto out;
 				}
 			}
@@ -320,8 +324,8 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 				if (status != NRF_WIFI_STATUS_SUCCESS) {
 					nrf_wifi_osal_log_err("%s: Reading of large event failed",
 							      __func__);
-					nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-					hal_dev_ctx->event_data = NULL;
+					nrf_wifi_osal_mem_free(hal_dev_ctx->event_msg);
+					hal_dev_ctx->event_msg = NULL;
 					goto out;
 				}
 			} else {
@@ -338,8 +342,8 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 				if (status != NRF_WIFI_STATUS_SUCCESS) {
 					nrf_wifi_osal_log_err("%s: Freeing up of the event failed",
 							      __func__);
-					nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-					hal_dev_ctx->event_data = NULL;
+					nrf_wifi_osal_mem_free(hal_dev_ctx->event_msg);
+					hal_dev_ctx->event_msg = NULL;
 					goto out;
 				}
 			}
@@ -354,7 +358,7 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 				  hal_dev_ctx->hpriv->cfg_params.max_event_size :
 				  hal_dev_ctx->event_data_pending;
 
-		if (hal_dev_ctx->event_data) {
+		if (hal_dev_ctx->event_msg) {
 			status = hal_rpu_mem_read(hal_dev_ctx,
 						  hal_dev_ctx->event_data_curr,
 						  event_addr,
@@ -363,8 +367,8 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 			if (status != NRF_WIFI_STATUS_SUCCESS) {
 				nrf_wifi_osal_log_err("%s: Reading of large event failed",
 						      __func__);
-				nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-				hal_dev_ctx->event_data = NULL;
+				nrf_wifi_osal_mem_free(hal_dev_ctx->event_msg);
+				hal_dev_ctx->event_msg = NULL;
 				goto out;
 			}
 		}
@@ -377,8 +381,8 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 			if (status != NRF_WIFI_STATUS_SUCCESS) {
 				nrf_wifi_osal_log_err("%s: Freeing up of the event failed",
 						      __func__);
-				nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-				hal_dev_ctx->event_data = NULL;
+				nrf_wifi_osal_mem_free(hal_dev_ctx->event_msg);
+				hal_dev_ctx->event_msg = NULL;
 				goto out;
 			}
 		}
@@ -391,23 +395,20 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 	 * fragmented event
 	 */
 	if (!hal_dev_ctx->event_data_pending) {
-		event = nrf_wifi_osal_mem_zalloc(sizeof(*event) + hal_dev_ctx->event_data_len);
+		event = hal_dev_ctx->event_msg;
+
+		/* Reset the state variables, the event queue owns the message
+		 * from here on
+		 */
+		hal_dev_ctx->event_msg = NULL;
+		hal_dev_ctx->event_data_curr = NULL;
+		hal_dev_ctx->event_resubmit = 0;
 
+		/* An earlier fragment of this event could not be read */
 		if (!event) {
-			nrf_wifi_osal_log_err("%s: Unable to alloc HAL msg for event (%d bytes)",
-					      __func__,
-						  hal_dev_ctx->event_data_len);
-			nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-			hal_dev_ctx->event_data = NULL;
 			goto out;
 		}
 
-		nrf_wifi_osal_mem_cpy(event->data,
-				      hal_dev_ctx->event_data,
-				      hal_dev_ctx->event_data_len);
-
-		event->len = hal_dev_ctx->event_data_len;
-
 		status = nrf_wifi_utils_ctrl_q_enqueue(hal_dev_ctx->event_q,
 						  event);
 
@@ -416,17 +417,8 @@ static enum nrf_wifi_status hal_rpu_event_get(struct nrf_wifi_hal_dev_ctx *hal_d
 					      __func__);
 			nrf_wifi_osal_mem_free(event);
 			event = NULL;
-			nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-			hal_dev_ctx->event_data = NULL;
 			goto out;
 		}
-
-		/* Reset the state variables */
-		nrf_wifi_osal_mem_free(hal_dev_ctx->event_data);
-		hal_dev_ctx->event_data = NULL;
-		hal_dev_ctx->event_data_curr = NULL;
-		hal_dev_ctx->event_data_len = 0;
-		hal_dev_ctx->event_resubmit = 0;
 	}
 out:
 	return status;
@@ -84,14 +84,17 @@ static enum nrf_wifi_status rpu_mem_read_ram(struct nrf_wifi_hal_dev_ctx *hal_de
 	unsigned long flags = 0;
 #endif /* NRF_WIFI_LOW_POWER */
 
-	status = pal_rpu_addr_offset_get(ram_addr_val,
-					 &addr_offset,
-					 hal_dev_ctx->curr_proc);
+	if (!pal_rpu_ram_addr_offset_get(ram_addr_val,
+					 &addr_offset)) {
+		status = pal_rpu_addr_offset_get(ram_addr_val,
+						 &addr_offset,
+						 hal_dev_ctx->curr_proc);
 
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: pal_rpu_addr_offset_get failed",
-				      __func__);
-		return status;
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: pal_rpu_addr_offset_get failed",
+					      __func__);
+			return status;
+		}
 	}
 
 #ifdef NRF_WIFI_LOW_POWER
@@ -143,14 +146,17 @@ static enum nrf_wifi_status rpu_mem_write_ram(struct nrf_wifi_hal_dev_ctx *hal_d
 	unsigned long flags = 0;
 #endif /* NRF_WIFI_LOW_POWER */
 
-	status = pal_rpu_addr_offset_get(ram_addr_val,
-					 &addr_offset,
-					 hal_dev_ctx->curr_proc);
+	if (!pal_rpu_ram_addr_offset_get(ram_addr_val,
+					 &addr_offset)) {
+		status = pal_rpu_addr_offset_get(ram_addr_val,
+						 &addr_offset,
+						 hal_dev_ctx->curr_proc);
 
-	if (status != NRF_WIFI_STATUS_SUCCESS) {
-		nrf_wifi_osal_log_err("%s: pal_rpu_addr_offset_get failed",
-				      __func__);
-		return status;
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: pal_rpu_addr_offset_get failed",
+					      __func__);
+			return status;
+		}
 	}
 
 #ifdef NRF_WIFI_LOW_POWER
@@ -200,8 +206,6 @@ static enum nrf_wifi_status rpu_mem_write_core(struct nrf_wifi_hal_dev_ctx *hal_
 	unsigned int addr_reg = 0;
 	unsigned int data_reg = 0;
 	unsigned int addr = 0;
-	unsigned int data = 0;
-	unsigned int i = 0;
 
 	/* The RPU core address is expected to be in multiples of 4 bytes (word
 	 * size). If not then something is amiss.
@@ -243,18 +247,17 @@ static enum nrf_wifi_status rpu_mem_write_core(struct nrf_wifi_hal_dev_ctx *hal_
 		goto out;
 	}
 
-	for (i = 0; i < (len / sizeof(int)); i++) {
-		data = *((unsigned int *)src_addr + i);
-
-		status = hal_rpu_reg_write(hal_dev_ctx,
-					   data_reg,
-					   data);
+	/* The data register auto increments the core memory address */
+	status = hal_rpu_reg_write_burst(hal_dev_ctx,
+					 data_reg,
+					 src_addr,
+					 len / sizeof(int),
+					 false);
 
-		if (status != NRF_WIFI_STATUS_SUCCESS) {
-			nrf_wifi_osal_log_err("%s: Writing to data reg failed",
-					      __func__);
-			goto out;
-		}
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Writing to data reg failed",
+				      __func__);
+		goto out;
 	}
 out:
 	return status;
@@ -287,8 +290,6 @@ static enum nrf_wifi_status rpu_mem_write_bev(struct nrf_wifi_hal_dev_ctx *hal_d
 {
 	int status = NRF_WIFI_STATUS_FAIL;
 	unsigned int addr = 0;
-	unsigned int data = 0;
-	unsigned int i = 0;
 
 	/* The RPU BEV address is expected to be in multiples of 4 bytes (word
 	 * size). If not then something is amiss.
@@ -301,25 +302,22 @@ static enum nrf_wifi_status rpu_mem_write_bev(struct nrf_wifi_hal_dev_ctx *hal_d
 		goto out;
 	}
 
-	for (i = 0; i < (len / sizeof(int)); i++) {
-		/* The BEV addresses need remapping
-		 * to an address on the SYSBUS.
-		 */
-		addr = rpu_get_bev_addr_remap(hal_dev_ctx,
-					      bev_addr_val +
-					      (i * sizeof(int)));
-
-		data = *((unsigned int *)src_addr + i);
+	/* The BEV addresses need remapping to an address on the SYSBUS, the
+	 * remapped registers are contiguous.
+	 */
+	addr = rpu_get_bev_addr_remap(hal_dev_ctx,
+				      bev_addr_val);
 
-		status = hal_rpu_reg_write(hal_dev_ctx,
-					   addr,
-					   data);
+	status = hal_rpu_reg_write_burst(hal_dev_ctx,
+					 addr,
+					 src_addr,
+					 len / sizeof(int),
+					 true);
 
-		if (status != NRF_WIFI_STATUS_SUCCESS) {
-			nrf_wifi_osal_log_err("%s: Writing to BEV reg failed",
-					      __func__);
-			goto out;
-		}
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Writing to BEV reg failed",
+				      __func__);
+		goto out;
 	}
 
 out:
@@ -377,6 +375,18 @@ enum nrf_wifi_status hal_rpu_mem_write(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 		return status;
 	}
 
+	/* Packet RAM and GRAM are the most frequently written, skip the
+	 * remaining region checks for them.
+	 */
+	if (hal_rpu_is_mem_ram(hal_dev_ctx->curr_proc,
+			       rpu_mem_addr_val)) {
+		status = rpu_mem_write_ram(hal_dev_ctx,
+					   rpu_mem_addr_val,
+					   src_addr,
+					   len);
+		goto out;
+	}
+
 	if (!hal_rpu_is_mem_writable(hal_dev_ctx->curr_proc,
 				     rpu_mem_addr_val)) {
 		nrf_wifi_osal_log_err("%s: Invalid memory address 0x%X",
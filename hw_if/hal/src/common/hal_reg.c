@@ -171,3 +171,106 @@ out:
 
 	return status;
 }
+
+
+/* Number of words written in one go while holding the RPU awake. The power
+ * save lock is held with interrupts disabled for the whole chunk, so keep it
+ * small to bound the interrupt latency.
+ */
+#ifndef HAL_RPU_REG_BURST_MAX_WORDS
+#define HAL_RPU_REG_BURST_MAX_WORDS 16
+#endif /* HAL_RPU_REG_BURST_MAX_WORDS */
+
+enum nrf_wifi_status hal_rpu_reg_write_burst(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					     unsigned int rpu_reg_addr,
+					     const unsigned int *vals,
+					     unsigned int num_vals,
+					     bool reg_addr_inc)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned long addr_offset = 0;
+	unsigned int last_reg_addr = rpu_reg_addr;
+	unsigned int burst_len = 0;
+	unsigned int i = 0;
+	unsigned int j = 0;
+#ifdef NRF_WIFI_LOW_POWER
+	unsigned long flags = 0;
+#endif /* NRF_WIFI_LOW_POWER */
+
+	if (!hal_dev_ctx) {
+		return status;
+	}
+
+	if (reg_addr_inc && num_vals) {
+		last_reg_addr = rpu_reg_addr + ((num_vals - 1) * sizeof(*vals));
+	}
+
+	if (!vals ||
+	    !hal_rpu_is_reg(rpu_reg_addr) ||
+	    ((last_reg_addr & RPU_ADDR_MASK_BASE) != (rpu_reg_addr & RPU_ADDR_MASK_BASE))) {
+		nrf_wifi_osal_log_err("%s: Invalid params, rpu_reg_addr (0x%X), num_vals %d",
+				      __func__,
+				      rpu_reg_addr,
+				      num_vals);
+		return status;
+	}
+
+	status = pal_rpu_addr_offset_get(rpu_reg_addr,
+					 &addr_offset,
+					 hal_dev_ctx->curr_proc);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: pal_rpu_get_region_offset failed",
+				      __func__);
+		return status;
+	}
+
+	for (i = 0; i < num_vals; i += burst_len) {
+		burst_len = num_vals - i;
+
+		if (burst_len > HAL_RPU_REG_BURST_MAX_WORDS) {
+			burst_len = HAL_RPU_REG_BURST_MAX_WORDS;
+		}
+
+#ifdef NRF_WIFI_LOW_POWER
+		nrf_wifi_osal_spinlock_irq_take(hal_dev_ctx->rpu_ps_lock,
+						&flags);
+
+		status = hal_rpu_ps_wake(hal_dev_ctx);
+
+		if (status != NRF_WIFI_STATUS_SUCCESS) {
+			nrf_wifi_osal_log_err("%s: RPU wake failed",
+					      __func__);
+			nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->rpu_ps_lock,
+						       &flags);
+			goto out;
+		}
+#endif /* NRF_WIFI_LOW_POWER */
+
+		for (j = i; j < i + burst_len; j++) {
+			nrf_wifi_bal_write_word(hal_dev_ctx->bal_dev_ctx,
+						addr_offset +
+						(reg_addr_inc ? (j * sizeof(*vals)) : 0),
+						vals[j]);
+		}
+
+#ifdef NRF_WIFI_LOW_POWER
+		nrf_wifi_osal_spinlock_irq_rel(hal_dev_ctx->rpu_ps_lock,
+					       &flags);
+#endif /* NRF_WIFI_LOW_POWER */
+	}
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+#ifdef NRF_WIFI_LOW_POWER
+	/* Schedule sleep timer after releasing the lock to prevent
+	 * it from firing during the critical section.
+	 */
+	if (status == NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_timer_schedule(hal_dev_ctx->rpu_ps_timer,
+					    NRF70_RPU_PS_IDLE_TIMEOUT_MS);
+	}
+#endif /* NRF_WIFI_LOW_POWER */
+
+	return status;
+}
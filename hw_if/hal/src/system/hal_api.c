@@ -141,6 +141,16 @@ unsigned long nrf_wifi_sys_hal_buf_map_rx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 
 	addr_to_map = bounce_buf_addr + hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz;
 
+#ifdef NRF_WIFI_RX_PERSIST_DMA_MAP
+	/* The bounce buffer of a slot never moves, so it only needs to be
+	 * mapped the first time the slot is used.
+	 */
+	if (rx_buf_info->persist_phy_addr) {
+		rx_buf_info->phy_addr = rx_buf_info->persist_phy_addr;
+		goto out;
+	}
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
+
 	rx_buf_info->phy_addr = nrf_wifi_bal_dma_map(hal_dev_ctx->bal_dev_ctx,
 						     addr_to_map,
 						     buf_len,
@@ -152,6 +162,9 @@ unsigned long nrf_wifi_sys_hal_buf_map_rx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 		goto out;
 	}
 
+#ifdef NRF_WIFI_RX_PERSIST_DMA_MAP
+	rx_buf_info->persist_phy_addr = rx_buf_info->phy_addr;
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
 out:
 	if (rx_buf_info->phy_addr) {
 		rx_buf_info->mapped = true;
@@ -170,6 +183,9 @@ unsigned long nrf_wifi_sys_hal_buf_unmap_rx(struct nrf_wifi_hal_dev_ctx *hal_dev
 	unsigned long unmapped_addr = 0;
 	unsigned long virt_addr = 0;
 	unsigned long rpu_addr = 0;
+#ifdef NRF_WIFI_RX_PERSIST_DMA_MAP
+	unsigned long persist_phy_addr = 0;
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
 
 	rx_buf_info = &hal_dev_ctx->rx_buf_info[pool_id][buf_id];
 
@@ -179,10 +195,21 @@ unsigned long nrf_wifi_sys_hal_buf_unmap_rx(struct nrf_wifi_hal_dev_ctx *hal_dev
 		goto out;
 	}
 
+#ifdef NRF_WIFI_RX_PERSIST_DMA_MAP
+	/* Keep the mapping, the frame is read out of the bounce buffer
+	 * below and the slot is handed back to the RPU with the same
+	 * DMA address.
+	 */
+	unmapped_addr = hal_dev_ctx->addr_rpu_pktram_base_rx_pool[pool_id] +
+		(buf_id * rx_buf_info->buf_len) +
+		hal_dev_ctx->hpriv->cfg_params.rx_buf_headroom_sz;
+	persist_phy_addr = rx_buf_info->persist_phy_addr;
+#else
 	unmapped_addr = nrf_wifi_bal_dma_unmap(hal_dev_ctx->bal_dev_ctx,
 					       rx_buf_info->phy_addr,
 					       rx_buf_info->buf_len,
 					       NRF_WIFI_OSAL_DMA_DIR_FROM_DEV);
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
 
 	rpu_addr = RPU_MEM_PKT_BASE + (unmapped_addr - hal_dev_ctx->addr_rpu_pktram_base);
 
@@ -205,11 +232,91 @@ unsigned long nrf_wifi_sys_hal_buf_unmap_rx(struct nrf_wifi_hal_dev_ctx *hal_dev
 	nrf_wifi_osal_mem_set(rx_buf_info,
 			      0,
 			      sizeof(*rx_buf_info));
+#ifdef NRF_WIFI_RX_PERSIST_DMA_MAP
+	rx_buf_info->persist_phy_addr = persist_phy_addr;
+#endif /* NRF_WIFI_RX_PERSIST_DMA_MAP */
 out:
 	return virt_addr;
 }
 
 
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+enum nrf_wifi_status nrf_wifi_sys_hal_buf_map_tx_flush(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_SUCCESS;
+
+	if (!hal_dev_ctx->tx_pack_len) {
+		goto out;
+	}
+
+	status = hal_rpu_mem_write(hal_dev_ctx,
+				   (unsigned int)hal_dev_ctx->tx_pack_rpu_addr,
+				   hal_dev_ctx->tx_pack_buf,
+				   hal_dev_ctx->tx_pack_len);
+
+	if (status != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: hal_rpu_mem_write failed",
+				      __func__);
+	}
+
+	hal_dev_ctx->tx_pack_len = 0;
+out:
+	return status;
+}
+
+
+static enum nrf_wifi_status hal_tx_pack(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
+					unsigned long rpu_addr,
+					unsigned long buf,
+					unsigned int buf_len)
+{
+	enum nrf_wifi_status status = NRF_WIFI_STATUS_FAIL;
+	unsigned int pack_offset = 0;
+
+	if (hal_dev_ctx->tx_pack_len) {
+		pack_offset = rpu_addr - hal_dev_ctx->tx_pack_rpu_addr;
+
+		if ((buf_len > NRF70_TX_PACK_MAX_FRM_SZ) ||
+		    ((pack_offset + buf_len) > NRF70_TX_PACK_BUF_SIZE)) {
+			status = nrf_wifi_sys_hal_buf_map_tx_flush(hal_dev_ctx);
+
+			if (status != NRF_WIFI_STATUS_SUCCESS) {
+				goto out;
+			}
+		}
+	}
+
+	if (buf_len > NRF70_TX_PACK_MAX_FRM_SZ) {
+		status = hal_rpu_mem_write(hal_dev_ctx,
+					   (unsigned int)rpu_addr,
+					   (void *)buf,
+					   buf_len);
+		goto out;
+	}
+
+	if (!hal_dev_ctx->tx_pack_len) {
+		hal_dev_ctx->tx_pack_rpu_addr = rpu_addr;
+		pack_offset = 0;
+	}
+
+	/* Clear the alignment padding and headroom between the frames */
+	nrf_wifi_osal_mem_set(hal_dev_ctx->tx_pack_buf + hal_dev_ctx->tx_pack_len,
+			      0,
+			      pack_offset - hal_dev_ctx->tx_pack_len);
+
+	nrf_wifi_osal_mem_cpy(hal_dev_ctx->tx_pack_buf + pack_offset,
+			      (void *)buf,
+			      buf_len);
+
+	hal_dev_ctx->tx_pack_len = pack_offset + buf_len;
+
+	status = NRF_WIFI_STATUS_SUCCESS;
+out:
+	return status;
+}
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
+
+
 unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_ctx,
 					  unsigned long buf,
 					  unsigned int buf_len,
@@ -245,6 +352,9 @@ unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 
 	if (buf_indx == 0) {
 		hal_dev_ctx->tx_frame_offset = tx_token_base_addr;
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+		hal_dev_ctx->tx_pack_len = 0;
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
 	}
 
 	bounce_buf_addr = hal_dev_ctx->tx_frame_offset;
@@ -265,10 +375,22 @@ unsigned long nrf_wifi_sys_hal_buf_map_tx(struct nrf_wifi_hal_dev_ctx *hal_dev_c
 	       buf_len,
 	       hal_dev_ctx->tx_frame_offset);
 
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+	if (hal_tx_pack(hal_dev_ctx,
+			rpu_addr,
+			buf,
+			buf_len) != NRF_WIFI_STATUS_SUCCESS) {
+		nrf_wifi_osal_log_err("%s: Unable to stage TX buffer (%d)",
+				      __func__,
+				      desc_id);
+		goto out;
+	}
+#else
 	hal_rpu_mem_write(hal_dev_ctx,
 			  (unsigned int)rpu_addr,
 			  (void *)buf,
 			  buf_len);
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
 
 	addr_to_map = bounce_buf_addr;
 
@@ -561,6 +683,16 @@ struct nrf_wifi_hal_dev_ctx *nrf_wifi_sys_hal_dev_add(struct nrf_wifi_hal_priv *
 				      __func__);
 		goto rx_buf_free;
 	}
+
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+	hal_dev_ctx->tx_pack_buf = nrf_wifi_osal_mem_zalloc(NRF70_TX_PACK_BUF_SIZE);
+
+	if (!hal_dev_ctx->tx_pack_buf) {
+		nrf_wifi_osal_log_err("%s: No space for TX pack buf",
+				      __func__);
+		goto tx_buf_free;
+	}
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
 #endif /* NRF70_DATA_TX */
 	status = nrf_wifi_sys_hal_rpu_pktram_buf_map_init(hal_dev_ctx);
 
@@ -575,6 +707,10 @@ struct nrf_wifi_hal_dev_ctx *nrf_wifi_sys_hal_dev_add(struct nrf_wifi_hal_priv *
 
 #ifdef NRF70_DATA_TX
 tx_buf_free:
+#ifdef NRF70_TX_PACK_SMALL_FRAMES
+	nrf_wifi_osal_mem_free(hal_dev_ctx->tx_pack_buf);
+	hal_dev_ctx->tx_pack_buf = NULL;
+#endif /* NRF70_TX_PACK_SMALL_FRAMES */
 	nrf_wifi_osal_mem_free(hal_dev_ctx->tx_buf_info);
 	hal_dev_ctx->tx_buf_info = NULL;
 rx_buf_free:
@@ -34,6 +34,10 @@ enum nrf_wifi_status nrf_wifi_utils_list_add_head(void *list,
 void nrf_wifi_utils_list_del_node(void *list,
 				  void *data);
 
+enum nrf_wifi_status nrf_wifi_utils_list_replace_node(void *list,
+						      void *old_data,
+						      void *new_data);
+
 void *nrf_wifi_utils_list_del_head(void *list);
 
 void *nrf_wifi_utils_ctrl_list_del_head(void *list);
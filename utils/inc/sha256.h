@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/**
+ * @brief Header containing SHA-256 specific declarations
+ * for the Wi-Fi driver.
+ */
+
+#ifndef __SHA256_H__
+#define __SHA256_H__
+
+#define NRF_WIFI_SHA256_BLOCK_LEN 64
+#define NRF_WIFI_SHA256_DIGEST_LEN 32
+
+struct nrf_wifi_utils_sha256_ctx {
+	unsigned int state[8];
+	unsigned long long total_len;
+	unsigned int buf_len;
+	unsigned char buf[NRF_WIFI_SHA256_BLOCK_LEN];
+};
+
+void nrf_wifi_utils_sha256_init(struct nrf_wifi_utils_sha256_ctx *ctx);
+
+void nrf_wifi_utils_sha256_update(struct nrf_wifi_utils_sha256_ctx *ctx,
+				  const void *data,
+				  unsigned int len);
+
+void nrf_wifi_utils_sha256_final(struct nrf_wifi_utils_sha256_ctx *ctx,
+				 unsigned char *digest);
+#endif /* __SHA256_H__ */
@@ -150,6 +150,29 @@ void nrf_wifi_utils_list_del_node(void *list,
 	}
 }
 
+enum nrf_wifi_status nrf_wifi_utils_list_replace_node(void *list,
+						      void *old_data,
+						      void *new_data)
+{
+	void *list_node = NULL;
+
+	list_node = nrf_wifi_osal_llist_get_node_head(list);
+
+	while (list_node) {
+		if (nrf_wifi_osal_llist_node_data_get(list_node) == old_data) {
+			nrf_wifi_osal_llist_node_data_set(list_node,
+							  new_data);
+
+			return NRF_WIFI_STATUS_SUCCESS;
+		}
+
+		list_node = nrf_wifi_osal_llist_get_node_nxt(list,
+							     list_node);
+	}
+
+	return NRF_WIFI_STATUS_FAIL;
+}
+
 void *nrf_wifi_utils_list_del_head(void *list)
 {
 	void *list_node = NULL;